@@ -0,0 +1,396 @@
+#ifndef MYLIBRARY_COMPILEDEXPR_H
+#define MYLIBRARY_COMPILEDEXPR_H
+
+#include "Vector.h"
+#include <cmath>
+#include <cstring>
+#include <cctype>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <limits>
+#include <memory>
+
+#define EXPR_LOCAL_STACK 64 // 求值栈深度不超过此值时使用函数内的定长数组，否则临时申请
+#define EXPR_BLOCK 512      // 批量求值时每块的行数
+#define EXPR_LOCAL_BLOCKS 8 // 批量求值所需的块缓冲区不超过此数时置于函数内，否则临时申请
+#define EXPR_FACT_MAX 34    // float 可表示的最大阶乘 34!，更大者溢出为 inf
+
+/* 表达式字节码的操作码 */
+typedef enum {
+    EXPR_CONST, EXPR_VAR, // 压入常量池第 arg 项、变量槽第 arg 项
+    EXPR_ADD, EXPR_SUB, EXPR_MUL, EXPR_DIV, EXPR_POW, EXPR_MAX, EXPR_MIN, // 二元：弹出 b、a，压入 a op b
+    EXPR_NEG, EXPR_SIN, EXPR_COS, EXPR_TAN, EXPR_SQRT, EXPR_LOG, EXPR_LN, EXPR_FACT // 一元：弹出 a，压入 op(a)
+} ExprOp;
+
+struct ExprInstr { unsigned char op; int arg; }; // 一条指令：操作码及其操作数（仅 EXPR_CONST、EXPR_VAR 使用）
+
+inline int exprArity(int op) { return op <= EXPR_VAR ? 0 : (op <= EXPR_MIN ? 2 : 1); }
+
+inline float exprApply(int op, float a) {
+    switch (op) {
+        case EXPR_NEG: return -a;
+        case EXPR_SIN: return std::sin(a);
+        case EXPR_COS: return std::cos(a);
+        case EXPR_TAN: return std::tan(a);
+        case EXPR_SQRT: return std::sqrt(a);
+        case EXPR_LOG: return std::log10(a);
+        case EXPR_LN: return std::log(a);
+        default: { // EXPR_FACT，同 calcu()：取整，负数得 0
+            if (a != a) return a; // NaN
+            if (a <= -1) return 0;
+            if (EXPR_FACT_MAX + 1 <= a) return std::numeric_limits<float>::infinity(); // 先于取整判断：避免越界转换，也避免长循环
+            int n = static_cast<int>(a);
+            float r = 1;
+            for (int i = 2; i <= n; ++i) r *= i;
+            return r;
+        }
+    }
+}
+inline float exprApply(int op, float a, float b) {
+    switch (op) {
+        case EXPR_ADD: return a + b;
+        case EXPR_SUB: return a - b;
+        case EXPR_MUL: return a * b;
+        case EXPR_DIV: return a / b;
+        case EXPR_POW: return std::pow(a, b);
+        case EXPR_MAX: return (a > b) ? a : b;
+        default: return (a < b) ? a : b; // EXPR_MIN
+    }
+}
+
+/* 批量求值的逐块运算。四则运算、max、min、取负与开方按向量逐段进行（各指令集下结果与逐个求值
+   完全相同：max/min 遇 NaN 时与标量版本同样取第二个操作数），其余函数逐个调用 <cmath>。
+   Lanes 给出一个指令集下的向量操作，W 为每个向量的元素数；标量版本 W = 1，兼作各块的收尾 */
+struct ExprScalarLanes {
+    typedef float V; enum { W = 1 };
+    static V load(float const* p) { return *p; }
+    static void store(float* p, V v) { *p = v; }
+    static V set1(float x) { return x; }
+    static V add(V a, V b) { return a + b; }
+    static V sub(V a, V b) { return a - b; }
+    static V mul(V a, V b) { return a * b; }
+    static V div(V a, V b) { return a / b; }
+    static V max(V a, V b) { return (a > b) ? a : b; }
+    static V min(V a, V b) { return (a < b) ? a : b; }
+    static V neg(V a) { return -a; }
+    static V sqrt(V a) { return std::sqrt(a); }
+};
+
+/* 二元运算 o[i] = a[i] op b[i]（AC、BC 表示该操作数为常量 ca、cb），一元运算 o[i] = op(a[i])；
+   返回已完成的元素数（W 的整数倍），余下者及不能向量化的运算由调用者以标量版本补足 */
+#define EXPR_BLOCK_KERNELS(PREFIX, ATTR)                                                        \
+template <typename L, bool AC, bool BC>                                                         \
+ATTR int PREFIX##Binary(int op, float* o, float const* a, float ca, float const* b, float cb, int m) { \
+    typename L::V va = L::set1(ca), vb = L::set1(cb);                                           \
+    int i = 0;                                                                                  \
+    switch (op) {                                                                               \
+    case EXPR_ADD: for (; i + L::W <= m; i += L::W) {                                           \
+        L::store(o + i, L::add(AC ? va : L::load(a + i), BC ? vb : L::load(b + i))); } break;   \
+    case EXPR_SUB: for (; i + L::W <= m; i += L::W) {                                           \
+        L::store(o + i, L::sub(AC ? va : L::load(a + i), BC ? vb : L::load(b + i))); } break;   \
+    case EXPR_MUL: for (; i + L::W <= m; i += L::W) {                                           \
+        L::store(o + i, L::mul(AC ? va : L::load(a + i), BC ? vb : L::load(b + i))); } break;   \
+    case EXPR_DIV: for (; i + L::W <= m; i += L::W) {                                           \
+        L::store(o + i, L::div(AC ? va : L::load(a + i), BC ? vb : L::load(b + i))); } break;   \
+    case EXPR_MAX: for (; i + L::W <= m; i += L::W) {                                           \
+        L::store(o + i, L::max(AC ? va : L::load(a + i), BC ? vb : L::load(b + i))); } break;   \
+    case EXPR_MIN: for (; i + L::W <= m; i += L::W) {                                           \
+        L::store(o + i, L::min(AC ? va : L::load(a + i), BC ? vb : L::load(b + i))); } break;   \
+    }                                                                                           \
+    return i;                                                                                   \
+}                                                                                               \
+template <typename L>                                                                           \
+ATTR int PREFIX##Unary(int op, float* o, float const* a, int m) {                               \
+    int i = 0;                                                                                  \
+    if (op == EXPR_NEG) for (; i + L::W <= m; i += L::W) L::store(o + i, L::neg(L::load(a + i))); \
+    else if (op == EXPR_SQRT) for (; i + L::W <= m; i += L::W) L::store(o + i, L::sqrt(L::load(a + i))); \
+    return i;                                                                                   \
+}
+
+EXPR_BLOCK_KERNELS(exprBlock, )
+
+#ifdef MYLIBRARY_SIMD_X86
+struct ExprSse2Lanes { // 与 Sse2Ops<float> 同宽
+    typedef __m128 V; enum { W = 4 };
+    static V load(float const* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+    static V set1(float x) { return _mm_set1_ps(x); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V div(V a, V b) { return _mm_div_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V neg(V a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+    static V sqrt(V a) { return _mm_sqrt_ps(a); }
+};
+struct ExprAvx2Lanes { // 与 Avx2Ops<float> 同宽
+    typedef __m256 V; enum { W = 8 };
+    SIMD_AVX2_TARGET static V load(float const* p) { return _mm256_loadu_ps(p); }
+    SIMD_AVX2_TARGET static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    SIMD_AVX2_TARGET static V set1(float x) { return _mm256_set1_ps(x); }
+    SIMD_AVX2_TARGET static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    SIMD_AVX2_TARGET static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    SIMD_AVX2_TARGET static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    SIMD_AVX2_TARGET static V div(V a, V b) { return _mm256_div_ps(a, b); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    SIMD_AVX2_TARGET static V neg(V a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+    SIMD_AVX2_TARGET static V sqrt(V a) { return _mm256_sqrt_ps(a); }
+};
+
+EXPR_BLOCK_KERNELS(exprAvx2, SIMD_AVX2_TARGET)
+#endif
+
+/* 二元运算的一块：a、b 为 NULL 时表示该操作数为常量 ca、cb（二者不会同为常量） */
+inline void exprBinaryBlock(int op, float* o, float const* a, float ca, float const* b, float cb, int m) {
+    int i = 0;
+    if (op != EXPR_POW) {
+#ifdef MYLIBRARY_SIMD_X86
+        if (simdLevel() == SIMD_AVX2)
+            i = !a ? exprAvx2Binary<ExprAvx2Lanes, true, false>(op, o, a, ca, b, cb, m)
+              : !b ? exprAvx2Binary<ExprAvx2Lanes, false, true>(op, o, a, ca, b, cb, m)
+                   : exprAvx2Binary<ExprAvx2Lanes, false, false>(op, o, a, ca, b, cb, m);
+        else if (simdLevel() == SIMD_SSE2)
+            i = !a ? exprBlockBinary<ExprSse2Lanes, true, false>(op, o, a, ca, b, cb, m)
+              : !b ? exprBlockBinary<ExprSse2Lanes, false, true>(op, o, a, ca, b, cb, m)
+                   : exprBlockBinary<ExprSse2Lanes, false, false>(op, o, a, ca, b, cb, m);
+#endif
+        o += i; if (a) a += i; if (b) b += i; m -= i; // 收尾
+        if (!a) exprBlockBinary<ExprScalarLanes, true, false>(op, o, a, ca, b, cb, m);
+        else if (!b) exprBlockBinary<ExprScalarLanes, false, true>(op, o, a, ca, b, cb, m);
+        else exprBlockBinary<ExprScalarLanes, false, false>(op, o, a, ca, b, cb, m);
+    } else
+        for (; i < m; ++i) o[i] = std::pow(a ? a[i] : ca, b ? b[i] : cb);
+}
+
+/* 一元运算的一块 */
+inline void exprUnaryBlock(int op, float* o, float const* a, int m) {
+    int i = 0;
+#ifdef MYLIBRARY_SIMD_X86
+    if (simdLevel() == SIMD_AVX2) i = exprAvx2Unary<ExprAvx2Lanes>(op, o, a, m);
+    else if (simdLevel() == SIMD_SSE2) i = exprBlockUnary<ExprSse2Lanes>(op, o, a, m);
+#endif
+    if (op == EXPR_NEG || op == EXPR_SQRT) exprBlockUnary<ExprScalarLanes>(op, o + i, a + i, m - i);
+    else for (; i < m; ++i) o[i] = exprApply(op, a[i]);
+}
+
+/* 预编译表达式：一次解析为后缀字节码，此后以不同的变量取值反复求值
+   - 支持 + - * / ^（右结合）、一元正负、后缀 !（阶乘）、括号，
+     函数 sin cos tan sqrt log（常用对数）ln，及二元函数 max(a, b) min(a, b)
+   - 其余标识符均视作变量，各占一个槽位；求值时以 values[槽位] 给出取值
+   - 编译时折叠常量子表达式，并求出求值栈的最大深度；求值只遍历指令，不解析、不申请空间
+   - 运算与 calcu() 相同按 float 进行，定义域以外（除以零、负数开方等）按 IEEE 754 得到 inf 或 NaN，
+     不抛出异常；语法错误则在编译时抛出 std::runtime_error */
+class CompiledExpr {
+private:
+    Vector<ExprInstr> _code;    // 字节码
+    Vector<float> _consts;      // 常量池
+    Vector<std::string> _vars;  // 变量名，下标即槽位
+    int _depth;                 // 求值栈的最大深度
+    bool _fixedVars;            // 变量表是否由调用者给定（此时不接受其它变量名）
+
+    // 解析器状态，仅在编译期间有效
+    const char* _src; const char* _p; int _sp;
+
+    /* 代码生成：操作数均为常量时就地折叠 */
+    void emit(int op, int arg = 0) {
+        int n = _code.size();
+        if (exprArity(op) == 1 && 0 < n && _code[n - 1].op == EXPR_CONST) {
+            float& a = _consts[_code[n - 1].arg];
+            a = exprApply(op, a);
+            return;
+        }
+        if (exprArity(op) == 2 && 1 < n && _code[n - 1].op == EXPR_CONST && _code[n - 2].op == EXPR_CONST) {
+            float& a = _consts[_code[n - 2].arg];
+            a = exprApply(op, a, _consts[_code[n - 1].arg]);
+            _consts.remove(_consts.size() - 1); // 右操作数总是最后登记的常量
+            _code.remove(n - 1);
+            _sp--;
+            return;
+        }
+        ExprInstr ins = { (unsigned char) op, arg };
+        _code.insert(ins);
+        _sp += 1 - exprArity(op);
+        if (_depth < _sp) _depth = _sp;
+    }
+
+    [[noreturn]] void fail(const char* what) const {
+        std::ostringstream os;
+        os << what << " (at position " << (_p - _src) << ")";
+        throw std::runtime_error(os.str());
+    }
+    void skip() { while (isspace((unsigned char) *_p)) _p++; }
+    bool accept(char c) { skip(); if (*_p != c) return false; _p++; return true; }
+    void expect(char c, const char* what) { if (!accept(c)) fail(what); }
+
+    /* 递归下降：expr := term (('+' | '-') term)*，term := unary (('*' | '/') unary)*，
+       unary := ('+' | '-') unary | power，power := postfix ('^' unary)?，postfix := primary '!'* */
+    void expr() {
+        term();
+        for (;;)
+            if (accept('+')) { term(); emit(EXPR_ADD); }
+            else if (accept('-')) { term(); emit(EXPR_SUB); }
+            else return;
+    }
+    void term() {
+        unary();
+        for (;;)
+            if (accept('*')) { unary(); emit(EXPR_MUL); }
+            else if (accept('/')) { unary(); emit(EXPR_DIV); }
+            else return;
+    }
+    void unary() {
+        if (accept('-')) { unary(); emit(EXPR_NEG); }
+        else if (accept('+')) unary();
+        else power();
+    }
+    void power() {
+        primary();
+        while (accept('!')) emit(EXPR_FACT);
+        if (accept('^')) { unary(); emit(EXPR_POW); } // 右结合，且 -2^2 = -(2^2)
+    }
+    void primary() {
+        skip();
+        if (isdigit((unsigned char) *_p) || *_p == '.') { // 数值
+            char* end;
+            float v = std::strtof(_p, &end);
+            if (end == _p) fail("Invalid number format!");
+            _p = end;
+            _consts.insert(v);
+            emit(EXPR_CONST, _consts.size() - 1);
+        } else if (isalpha((unsigned char) *_p) || *_p == '_') { // 函数或变量
+            const char* s = _p;
+            while (isalnum((unsigned char) *_p) || *_p == '_') _p++;
+            std::string name(s, _p - s);
+            int f = function(name);
+            if (f < 0) { emit(EXPR_VAR, slot(name)); return; }
+            expect('(', "Expected '(' after function!");
+            expr();
+            if (exprArity(f) == 2) { expect(',', "Expected ','!"); expr(); }
+            expect(')', "Unmatched parentheses!");
+            emit(f);
+        } else if (accept('(')) {
+            expr();
+            expect(')', "Unmatched parentheses!");
+        } else if (*_p) fail("Expected operand!");
+        else fail(_code.empty() ? "Empty expression!" : "Expression ends with operator!");
+    }
+
+    static int function(std::string const& name) { // 函数名对应的操作码，非函数返回 -1
+        static const char* names[] = { "sin", "cos", "tan", "sqrt", "log", "ln", "max", "min" };
+        static const int ops[] = { EXPR_SIN, EXPR_COS, EXPR_TAN, EXPR_SQRT, EXPR_LOG, EXPR_LN, EXPR_MAX, EXPR_MIN };
+        for (int i = 0; i < 8; i++) if (name == names[i]) return ops[i];
+        return -1;
+    }
+    int slot(std::string const& name) { // 变量名对应的槽位，必要时登记
+        for (int i = 0; i < _vars.size(); i++) if (_vars[i] == name) return i;
+        if (_fixedVars) fail("Unknown variable!");
+        _vars.insert(name);
+        return _vars.size() - 1;
+    }
+
+    void compile(const char* expression) {
+        _src = _p = expression; _sp = 0; _depth = 0;
+        expr();
+        skip();
+        if (*_p == ')') fail("Unmatched closing parenthesis!");
+        if (*_p) fail("Expected operator!");
+        _src = _p = NULL;
+    }
+
+public:
+    /* 编译表达式，变量按首次出现的次序编排槽位 */
+    explicit CompiledExpr(const char* expression) : _depth(0), _fixedVars(false) { compile(expression); }
+    /* 编译表达式，变量槽位依次为 names[0, n)，出现其它变量名视为错误 */
+    CompiledExpr(const char* expression, const char* const names[], int n) : _depth(0), _fixedVars(true) {
+        for (int i = 0; i < n; i++) _vars.insert(std::string(names[i]));
+        compile(expression);
+    }
+
+    int variables() const { return _vars.size(); } // 变量槽位数
+    const char* variable(int i) const { return _vars[i].c_str(); } // 槽位 i 的变量名
+    int slotOf(const char* name) const { // 变量名对应的槽位，不存在时返回 -1
+        for (int i = 0; i < _vars.size(); i++) if (_vars[i] == name) return i;
+        return -1;
+    }
+    int instructions() const { return _code.size(); } // 指令条数
+    int depth() const { return _depth; } // 求值栈的最大深度
+    ExprInstr const* code() const { return &_code[0]; } // 字节码
+    float constant(int i) const { return _consts[i]; } // 常量池第 i 项
+
+    /* 求值：values[i] 为槽位 i 的取值（无变量时可为 NULL）；可被多个线程同时调用 */
+    float evaluate(const float* values = NULL) const {
+        float local[EXPR_LOCAL_STACK];
+        local[0] = 0; // 字节码非空，栈底总会被写入；此句只为免去编译器“可能未初始化”的误报
+        std::unique_ptr<float[]> heap; // 空指针，不申请空间
+        float* st = local;
+        if (EXPR_LOCAL_STACK < _depth) { heap.reset(new float[_depth]); st = heap.get(); }
+        int sp = 0;
+        for (ExprInstr const* ins = &_code[0], *end = ins + _code.size(); ins < end; ++ins)
+            switch (ins->op) {
+                case EXPR_CONST: st[sp++] = _consts[ins->arg]; break;
+                case EXPR_VAR: st[sp++] = values[ins->arg]; break;
+                case EXPR_ADD: sp--; st[sp - 1] += st[sp]; break;
+                case EXPR_SUB: sp--; st[sp - 1] -= st[sp]; break;
+                case EXPR_MUL: sp--; st[sp - 1] *= st[sp]; break;
+                case EXPR_DIV: sp--; st[sp - 1] /= st[sp]; break;
+                case EXPR_POW: case EXPR_MAX: case EXPR_MIN: sp--; st[sp - 1] = exprApply(ins->op, st[sp - 1], st[sp]); break;
+                case EXPR_NEG: st[sp - 1] = -st[sp - 1]; break;
+                default: st[sp - 1] = exprApply(ins->op, st[sp - 1]); break;
+            }
+        return st[0];
+    }
+    float operator()(const float* values = NULL) const { return evaluate(values); }
+
+    /* 批量求值：columns[i] 为槽位 i 的 n 个取值，out[r] 为第 r 行的结果。
+       每块 EXPR_BLOCK 行，每条指令对整块执行一趟紧凑的循环，解释开销由每行一次降为每块一次；
+       栈中的变量直接引用所在列，常量不展开，末条指令直接写入 out。out 可与某一列重合 */
+    void evaluate(const float* const columns[], int n, float* out) const {
+        float local[EXPR_LOCAL_BLOCKS * EXPR_BLOCK];
+        std::unique_ptr<float[]> heap; // 以下三者仅在栈深超出函数内数组时申请
+        float* buf = local; // 求值栈第 k 层的中间结果存放于 buf[k * EXPR_BLOCK, (k + 1) * EXPR_BLOCK)
+        if (EXPR_LOCAL_BLOCKS < _depth) { heap.reset(new float[(size_t) _depth * EXPR_BLOCK]); buf = heap.get(); }
+        float const* src[EXPR_LOCAL_STACK]; float val[EXPR_LOCAL_STACK]; // 各层操作数：数组，或为 NULL 时取常量
+        std::unique_ptr<float const*[]> srcHeap; std::unique_ptr<float[]> valHeap;
+        float const** sp0 = src; float* vp0 = val;
+        if (EXPR_LOCAL_STACK < _depth) {
+            srcHeap.reset(new float const*[_depth]); valHeap.reset(new float[_depth]);
+            sp0 = srcHeap.get(); vp0 = valHeap.get();
+        }
+        ExprInstr const* code = &_code[0]; int last = _code.size() - 1;
+        for (int base = 0; base < n; base += EXPR_BLOCK) {
+            int m = (n - base < EXPR_BLOCK) ? n - base : EXPR_BLOCK;
+            int sp = 0;
+            for (int k = 0; k <= last; ++k) {
+                int op = code[k].op;
+                if (op == EXPR_CONST) { sp0[sp] = NULL; vp0[sp++] = _consts[code[k].arg]; continue; }
+                if (op == EXPR_VAR) { sp0[sp++] = columns[code[k].arg] + base; continue; }
+                int t = sp - exprArity(op); // 结果所在的层
+                float* o = (k == last) ? out + base : buf + t * EXPR_BLOCK;
+                if (exprArity(op) == 2) exprBinaryBlock(op, o, sp0[t], vp0[t], sp0[t + 1], vp0[t + 1], m);
+                else exprUnaryBlock(op, o, sp0[t], m);
+                sp0[t] = o; sp = t + 1;
+            }
+            if (sp0[0] != out + base) // 整个表达式只是一个常量或变量
+                for (int i = 0; i < m; ++i) out[base + i] = sp0[0] ? sp0[0][i] : vp0[0];
+        }
+    }
+
+    /* 后缀表达式（逆波兰式）文本，以空格分隔；函数以其名称表示，取负记作 neg */
+    std::string rpn() const {
+        static const char* names[] = { "", "", "+", "-", "*", "/", "^", "max", "min",
+                                       "neg", "sin", "cos", "tan", "sqrt", "log", "ln", "!" };
+        std::ostringstream os;
+        for (int i = 0; i < _code.size(); i++) {
+            if (i) os << ' ';
+            if (_code[i].op == EXPR_CONST) os << _consts[_code[i].arg];
+            else if (_code[i].op == EXPR_VAR) os << _vars[_code[i].arg];
+            else os << names[_code[i].op];
+        }
+        return os.str();
+    }
+};
+
+#endif // MYLIBRARY_COMPILEDEXPR_H
@@ -0,0 +1,164 @@
+#ifndef MYLIBRARY_CONCURRENTQUEUE_H
+#define MYLIBRARY_CONCURRENTQUEUE_H
+
+#include "Vector.h"
+#include <atomic>
+#include <thread>
+#include <cstdint>
+
+#define CACHE_LINE 64           // 缓存行字节数；各线程频繁改写的下标之间以此填充，避免伪共享
+#define CONCURRENT_SPINS 64     // 阻塞式操作先忙等的次数，此后每次重试前让出处理器
+
+/* 阻塞式操作的退避：先忙等若干次，再改为让出处理器 */
+inline void concurrentBackoff(int& spins) {
+    if (CONCURRENT_SPINS <= ++spins) std::this_thread::yield();
+}
+
+inline size_t concurrentCapacity(size_t c) { // 上调至 2 的幂（至少为 2）
+    size_t cap = 2;
+    while (cap < c) cap <<= 1;
+    return cap;
+}
+
+/* 单生产者单消费者有界队列：环形缓冲区，无锁且无等待
+   - 恰有一个线程调用 push 系列、一个线程调用 pop 系列，两者可同时进行
+   - 读、写位置单调递增，按掩码映射至缓冲区；各自只由一方改写，另一方以 acquire 读取
+   - 双方各缓存一份对方的位置，仅当按缓存判断为满（空）时才重读，减少缓存行往返 */
+template <typename T>
+class SpscQueue {
+private:
+    T* _elem; size_t _mask; // 缓冲区、容量减一
+    char _pad0[CACHE_LINE];
+    std::atomic<size_t> _head; size_t _tailCache; // 读位置（消费者改写），消费者所见的写位置
+    char _pad1[CACHE_LINE];
+    std::atomic<size_t> _tail; size_t _headCache; // 写位置（生产者改写），生产者所见的读位置
+    char _pad2[CACHE_LINE];
+
+    template <typename U>
+    bool put(U&& e) {
+        size_t t = _tail.load(std::memory_order_relaxed);
+        if (t - _headCache > _mask) { // 似乎已满，重读读位置
+            _headCache = _head.load(std::memory_order_acquire);
+            if (t - _headCache > _mask) return false;
+        }
+        new (_elem + (t & _mask)) T(std::forward<U>(e));
+        _tail.store(t + 1, std::memory_order_release); // 发布新元素
+        return true;
+    }
+
+public:
+    explicit SpscQueue(size_t capacity) : _head(0), _tailCache(0), _tail(0), _headCache(0) {
+        size_t c = concurrentCapacity(capacity);
+        _elem = static_cast<T*>(std::malloc(sizeof(T) * c));
+        if (!_elem) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(T) * c);
+        _mask = c - 1;
+    }
+    ~SpscQueue() {
+        for (size_t h = _head.load(), t = _tail.load(); h != t; h++) _elem[h & _mask].~T();
+        std::free(_elem);
+    }
+    SpscQueue(SpscQueue const&) = delete;
+    SpscQueue& operator=(SpscQueue const&) = delete;
+
+    size_t capacity() const { return _mask + 1; }
+    size_t size() const { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); } // 并发时仅为近似值
+
+    bool tryPush(T const& e) { return put(e); } // 队满时返回 false
+    bool tryPush(T&& e) { return put(std::move(e)); }
+    bool tryPop(T& e) { // 队空时返回 false
+        size_t h = _head.load(std::memory_order_relaxed);
+        if (h == _tailCache) { // 似乎已空，重读写位置
+            _tailCache = _tail.load(std::memory_order_acquire);
+            if (h == _tailCache) return false;
+        }
+        T* p = _elem + (h & _mask);
+        e = std::move(*p); p->~T();
+        _head.store(h + 1, std::memory_order_release); // 归还该槽位
+        return true;
+    }
+
+    void push(T const& e) { for (int spins = 0; !put(e); ) concurrentBackoff(spins); } // 队满时等待
+    void push(T&& e) { for (int spins = 0; !put(std::move(e)); ) concurrentBackoff(spins); }
+    void pop(T& e) { for (int spins = 0; !tryPop(e); ) concurrentBackoff(spins); } // 队空时等待
+};
+
+/* 多生产者多消费者有界队列（Vyukov）：环形缓冲区，每个槽位附有序号
+   - 槽位 i 的序号初始为 i；写位置 pos 处的槽位序号等于 pos 时可写，写毕置为 pos + 1；
+     读位置 pos 处的槽位序号等于 pos + 1 时可读，读毕置为 pos + 容量，留待下一圈写入
+   - 生产者之间、消费者之间各自以 CAS 争夺位置，争得后独占该槽位；生产者与消费者只经由
+     槽位序号同步，互不争用
+   - 无锁：任一线程的 CAS 失败必因另一线程已成功推进 */
+template <typename T>
+class MpmcQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+        T* elem() { return reinterpret_cast<T*>(&data); }
+    };
+    Cell* _cells; size_t _mask;
+    char _pad0[CACHE_LINE];
+    std::atomic<size_t> _enqueuePos; // 写位置
+    char _pad1[CACHE_LINE];
+    std::atomic<size_t> _dequeuePos; // 读位置
+    char _pad2[CACHE_LINE];
+
+    template <typename U>
+    bool put(U&& e) {
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        Cell* c;
+        for (;;) {
+            c = _cells + (pos & _mask);
+            intptr_t dif = (intptr_t) c->seq.load(std::memory_order_acquire) - (intptr_t) pos;
+            if (dif == 0) { // 槽位可写，争夺该位置
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) return false; // 槽位尚未被上一圈读走：队满
+            else pos = _enqueuePos.load(std::memory_order_relaxed); // 已被其它生产者占用
+        }
+        new (c->elem()) T(std::forward<U>(e));
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    explicit MpmcQueue(size_t capacity) : _enqueuePos(0), _dequeuePos(0) {
+        size_t c = concurrentCapacity(capacity);
+        _cells = new Cell[c];
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(Cell) * c);
+        _mask = c - 1;
+        for (size_t i = 0; i < c; i++) _cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+    ~MpmcQueue() {
+        for (size_t h = _dequeuePos.load(), t = _enqueuePos.load(); h != t; h++) _cells[h & _mask].elem()->~T();
+        delete[] _cells;
+    }
+    MpmcQueue(MpmcQueue const&) = delete;
+    MpmcQueue& operator=(MpmcQueue const&) = delete;
+
+    size_t capacity() const { return _mask + 1; }
+
+    bool tryPush(T const& e) { return put(e); } // 队满时返回 false
+    bool tryPush(T&& e) { return put(std::move(e)); }
+    bool tryPop(T& e) { // 队空时返回 false
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        Cell* c;
+        for (;;) {
+            c = _cells + (pos & _mask);
+            intptr_t dif = (intptr_t) c->seq.load(std::memory_order_acquire) - (intptr_t) (pos + 1);
+            if (dif == 0) { // 槽位可读，争夺该位置
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) return false; // 槽位尚未写入：队空
+            else pos = _dequeuePos.load(std::memory_order_relaxed); // 已被其它消费者占用
+        }
+        e = std::move(*c->elem()); c->elem()->~T();
+        c->seq.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    void push(T const& e) { for (int spins = 0; !put(e); ) concurrentBackoff(spins); } // 队满时等待
+    void push(T&& e) { for (int spins = 0; !put(std::move(e)); ) concurrentBackoff(spins); }
+    void pop(T& e) { for (int spins = 0; !tryPop(e); ) concurrentBackoff(spins); } // 队空时等待
+};
+
+#endif // MYLIBRARY_CONCURRENTQUEUE_H
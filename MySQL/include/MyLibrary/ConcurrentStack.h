@@ -0,0 +1,158 @@
+#ifndef MYLIBRARY_CONCURRENTSTACK_H
+#define MYLIBRARY_CONCURRENTSTACK_H
+
+#include "ConcurrentQueue.h" // CACHE_LINE、concurrentBackoff
+#include "Random.h"          // 消去数组的随机选位
+
+#define STACK_FIRST_SEGMENT 64      // 首段所含节点数（2 的幂），此后各段逐次倍增
+#define STACK_SEGMENTS 26           // 段数上限，节点总数不超过 STACK_FIRST_SEGMENT * (2^26 - 1)
+#define STACK_ELIMINATION_SPINS 64  // 入栈者在消去槽中等待配对的轮数
+
+/* 无锁并发栈（Treiber）
+   - 栈顶为一个 64 位字：低 32 位为栈顶节点的编号，高 32 位为版本号，每次修改栈顶均加一，
+     故单字 CAS 即可识别 ABA（其间栈顶被弹出、又被同一节点压回）
+   - 节点取自栈内的节点池：各段依次倍增，仅随栈销毁而释放；弹出的节点挂入同样以版本号
+     保护的空闲链表，优先复用。节点内存始终有效，故竞争失败者读到的陈旧后继无害
+   - 可选消去数组（elimination backoff）：栈顶 CAS 失败时，入栈者将节点放入随机选取的
+     槽位等待片刻，出栈者在槽位中发现节点即直接取走，两次操作相互抵消而不经过栈顶，
+     高争用时分散对栈顶的竞争
+   - 元素于入栈时构造于节点内，出栈时移出并析构 */
+template <typename T>
+class ConcurrentStack {
+private:
+    static const uint32_t NIL = 0xFFFFFFFFu; // 空编号
+
+    struct Node {
+        std::atomic<uint32_t> next; // 后继节点的编号（可能被竞争失败者并发读取）
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+        T* elem() { return reinterpret_cast<T*>(&data); }
+    };
+    struct Slot { std::atomic<uint64_t> v; char pad[CACHE_LINE - sizeof(std::atomic<uint64_t>)]; }; // 消去槽：（版本号，节点编号）
+
+    std::atomic<Node*> _seg[STACK_SEGMENTS]; // 节点池各段
+    Slot* _slots; int _width;                // 消去数组及其宽度（0 表示不用）
+    char _pad0[CACHE_LINE];
+    std::atomic<uint64_t> _head;             // 栈顶
+    char _pad1[CACHE_LINE];
+    std::atomic<uint64_t> _free;             // 空闲节点链表
+    char _pad2[CACHE_LINE];
+    std::atomic<uint32_t> _fresh;            // 尚未启用的最小节点编号
+    char _pad3[CACHE_LINE];
+
+    static uint64_t tagged(uint64_t old, uint32_t i) { return ((old >> 32) + 1) << 32 | i; } // 版本号加一，编号改为 i
+
+    static int highBit(uint32_t x) { // 最高位的位置（x > 0）
+#if defined(__GNUC__)
+        return 31 - __builtin_clz(x);
+#else
+        int b = 0; while (x >>= 1) b++; return b;
+#endif
+    }
+    static void locate(uint32_t i, int& s, uint32_t& off) { // 编号 i 所在的段与段内偏移
+        uint32_t j = i + STACK_FIRST_SEGMENT;
+        s = highBit(j) - highBit(STACK_FIRST_SEGMENT);
+        off = j - ((uint32_t) STACK_FIRST_SEGMENT << s);
+    }
+    Node* node(uint32_t i) const {
+        int s; uint32_t off; locate(i, s, off);
+        return _seg[s].load(std::memory_order_acquire) + off;
+    }
+
+    void pushIndex(std::atomic<uint64_t>& head, uint32_t i) { // 将节点 i 压入以 head 为顶的链
+        Node* n = node(i);
+        uint64_t old = head.load(std::memory_order_relaxed);
+        do n->next.store((uint32_t) old, std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(old, tagged(old, i), std::memory_order_release, std::memory_order_relaxed));
+    }
+    uint32_t popIndex(std::atomic<uint64_t>& head) { // 自以 head 为顶的链弹出一个节点，链空时返回 NIL
+        uint64_t old = head.load(std::memory_order_acquire);
+        for (uint32_t i; NIL != (i = (uint32_t) old); )
+            if (head.compare_exchange_weak(old, tagged(old, node(i)->next.load(std::memory_order_relaxed)),
+                                           std::memory_order_acq_rel, std::memory_order_acquire))
+                return i;
+        return NIL;
+    }
+
+    uint32_t allocNode() { // 优先复用空闲节点，否则启用新编号（所在段尚未分配时分配之）
+        uint32_t i = popIndex(_free);
+        if (NIL != i) return i;
+        i = _fresh.fetch_add(1, std::memory_order_relaxed);
+        int s; uint32_t off; locate(i, s, off);
+        if (STACK_SEGMENTS <= s) throw std::bad_alloc();
+        if (!_seg[s].load(std::memory_order_acquire)) { // 多个线程可能同时分配同一段，仅一个胜出
+            Node* p = new Node[(size_t) STACK_FIRST_SEGMENT << s];
+            Node* expected = NULL;
+            if (_seg[s].compare_exchange_strong(expected, p, std::memory_order_acq_rel)) {
+                OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(Node) * ((size_t) STACK_FIRST_SEGMENT << s));
+            } else delete[] p;
+        }
+        return i;
+    }
+
+    bool offer(uint32_t i) { // 入栈者在消去槽中等待出栈者取走节点 i，成功返回 true
+        Slot& s = _slots[threadRng().uniform(_width)];
+        uint64_t cur = s.v.load(std::memory_order_relaxed);
+        if (NIL != (uint32_t) cur) return false; // 槽位已被占用
+        uint64_t mine = tagged(cur, i);
+        if (!s.v.compare_exchange_strong(cur, mine, std::memory_order_release, std::memory_order_relaxed)) return false;
+        for (int k = 0; k < STACK_ELIMINATION_SPINS; k++)
+            if (s.v.load(std::memory_order_acquire) != mine) return true; // 已被取走
+        return !s.v.compare_exchange_strong(mine, tagged(mine, NIL), std::memory_order_acq_rel); // 撤回；失败说明恰被取走
+    }
+    uint32_t take() { // 出栈者从随机选取的消去槽中取走等待中的节点，没有则返回 NIL
+        Slot& s = _slots[threadRng().uniform(_width)];
+        uint64_t cur = s.v.load(std::memory_order_acquire);
+        uint32_t i = (uint32_t) cur;
+        if (NIL == i) return NIL;
+        return s.v.compare_exchange_strong(cur, tagged(cur, NIL), std::memory_order_acq_rel) ? i : NIL;
+    }
+
+    void pushNode(uint32_t i) {
+        Node* n = node(i);
+        uint64_t old = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            n->next.store((uint32_t) old, std::memory_order_relaxed);
+            if (_head.compare_exchange_weak(old, tagged(old, i), std::memory_order_release, std::memory_order_relaxed)) return;
+            if (_width && offer(i)) return; // 与某次出栈相抵
+            old = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+public:
+    explicit ConcurrentStack(int elimination = 0) // elimination 为消去数组的宽度，0 表示不用
+        : _slots(NULL), _width(elimination < 0 ? 0 : elimination), _head(NIL), _free(NIL), _fresh(0) {
+        for (int s = 0; s < STACK_SEGMENTS; s++) _seg[s].store(NULL, std::memory_order_relaxed);
+        if (_width) {
+            _slots = new Slot[_width];
+            for (int k = 0; k < _width; k++) _slots[k].v.store(NIL, std::memory_order_relaxed);
+        }
+    }
+    ~ConcurrentStack() {
+        for (uint32_t i = (uint32_t) _head.load(); NIL != i; i = node(i)->next.load()) node(i)->elem()->~T();
+        for (int s = 0; s < STACK_SEGMENTS; s++) delete[] _seg[s].load();
+        delete[] _slots;
+    }
+    ConcurrentStack(ConcurrentStack const&) = delete;
+    ConcurrentStack& operator=(ConcurrentStack const&) = delete;
+
+    void push(T const& e) { uint32_t i = allocNode(); new (node(i)->elem()) T(e); pushNode(i); }
+    void push(T&& e) { uint32_t i = allocNode(); new (node(i)->elem()) T(std::move(e)); pushNode(i); }
+    bool pop(T& e) { // 栈空时返回 false
+        uint64_t old = _head.load(std::memory_order_acquire);
+        uint32_t i;
+        for (;;) {
+            if (NIL == (i = (uint32_t) old)) return false;
+            if (_head.compare_exchange_weak(old, tagged(old, node(i)->next.load(std::memory_order_relaxed)),
+                                            std::memory_order_acq_rel, std::memory_order_acquire)) break;
+            if (_width && NIL != (i = take())) break; // 与某次入栈相抵
+            old = _head.load(std::memory_order_acquire);
+        }
+        T* p = node(i)->elem();
+        e = std::move(*p); p->~T();
+        pushIndex(_free, i);
+        return true;
+    }
+    bool empty() const { return NIL == (uint32_t) _head.load(std::memory_order_acquire); } // 并发时仅为瞬时状态
+};
+
+#endif // MYLIBRARY_CONCURRENTSTACK_H
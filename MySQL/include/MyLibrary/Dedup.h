@@ -0,0 +1,63 @@
+#ifndef MYLIBRARY_DEDUP_H
+#define MYLIBRARY_DEDUP_H
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "OpStats.h"
+
+typedef int Rank;
+
+/* T 是否有可用的 std::hash（未特化的 std::hash 不可构造或不可调用） */
+template <typename T>
+struct HasStdHash {
+private:
+    template <typename U>
+    static auto test(int) -> decltype(std::hash<U>()(std::declval<U const&>()), std::true_type());
+    template <typename U>
+    static std::false_type test(...);
+
+public:
+    typedef decltype(test<T>(0)) type;
+    static const bool value = type::value;
+};
+
+/* 去重用的散列表：开放定址、线性试探，只登记元素地址而不复制元素。
+   登记的元素在表的生存期内不得移动；容量取不小于 2n 的 2 的幂，装填因子不超过 1/2 */
+template <typename T, typename Hash, typename Eq>
+class DedupTable {
+private:
+    struct Slot { unsigned long long h; T const* e; }; // 混合后的散列码、元素地址（NULL 为空）
+    Slot* _slot;
+    unsigned long long _mask;
+    int _shift; // 取乘积高位作桶号
+    Hash _hash;
+    Eq _eq;
+
+    DedupTable(DedupTable const&) = delete;
+    DedupTable& operator=(DedupTable const&) = delete;
+
+public:
+    DedupTable(Rank n, Hash hash, Eq eq) : _hash(hash), _eq(eq) {
+        int bits = 1;
+        while ((1LL << bits) < 2LL * n) ++bits;
+        _slot = new Slot[1ULL << bits]();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(Slot) << bits);
+        _mask = (1ULL << bits) - 1;
+        _shift = 64 - bits;
+    }
+    ~DedupTable() { delete[] _slot; }
+
+    /* 若表中尚无与 e 相等者，则登记 e 并返回 true；否则返回 false */
+    bool insert(T const& e) {
+        // 乘以黄金分割常数再取高位，避免恒等散列（如整数）在低位聚集
+        unsigned long long h = (unsigned long long) _hash(e) * 0x9E3779B97F4A7C15ULL;
+        unsigned long long i = h >> _shift;
+        for (; _slot[i].e; i = (i + 1) & _mask)
+            if (_slot[i].h == h && _eq(*_slot[i].e, e)) return false;
+        _slot[i].h = h; _slot[i].e = &e;
+        return true;
+    }
+};
+
+#endif // MYLIBRARY_DEDUP_H
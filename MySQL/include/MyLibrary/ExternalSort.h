@@ -0,0 +1,262 @@
+#ifndef MYLIBRARY_EXTERNALSORT_H
+#define MYLIBRARY_EXTERNALSORT_H
+
+#include "Vector.h"
+#include "PQ_ComplHeap.h"
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <chrono>
+
+#define EXTSORT_MIN_BLOCK (1 << 16) // 归并阶段每块读写缓冲区的最小字节数，决定单趟最大路数
+
+/* 外排序统计 */
+struct ExternalSortStats {
+    long long records;  // 记录数
+    int runs;           // 初始归并段数
+    int passes;         // 归并趟数
+    double runMs;       // 生成归并段耗时
+    double mergeMs;     // 归并耗时
+};
+
+/* 读入至多 cap 条长为 size 的记录，*n 为实际读入的条数。读不满时须是到达文件尾，
+   且文件末尾没有残缺的记录（按字节读取，以便发现之），否则返回 false */
+inline bool readRecords(FILE* fp, void* A, size_t size, Rank cap, Rank* n) {
+    size_t bytes = fread(A, 1, size * (size_t) cap, fp);
+    *n = (Rank) (bytes / size);
+    return bytes == size * (size_t) cap || (!ferror(fp) && bytes % size == 0);
+}
+
+/* 归并段读取器：内存块一分为二，读取一半时由 I/O 线程预读另一半 */
+template <typename T>
+class RunReader {
+private:
+    FILE* _fp;
+    T* _buf[2];
+    Rank _cap, _n[2], _pos;
+    int _cur;
+    bool _eof, _ok;
+    std::thread _io;
+
+    void fill(int h) {
+        if (!readRecords(_fp, _buf[h], sizeof(T), _cap, &_n[h])) _ok = false;
+        if (_n[h] < _cap) _eof = true;
+    }
+
+public:
+    RunReader() : _fp(NULL) {}
+    ~RunReader() { close(); }
+
+    /* 以 mem[0, 2 * cap) 为缓冲区打开归并段 */
+    bool open(const char* path, T* mem, Rank cap) {
+        if (!(_fp = fopen(path, "rb"))) return false;
+        setvbuf(_fp, NULL, _IONBF, 0);
+        _buf[0] = mem; _buf[1] = mem + cap; _cap = cap;
+        _cur = 0; _pos = 0; _eof = false; _ok = true;
+        fill(0);
+        if (_eof) _n[1] = 0;
+        else _io = std::thread(&RunReader::fill, this, 1);
+        return true;
+    }
+
+    /* 取出下一条记录；归并段耗尽时返回 false */
+    bool next(T& e) {
+        if (_pos == _n[_cur]) {
+            if (_io.joinable()) _io.join(); // 另一半已就绪
+            if (!_n[1 - _cur]) return false;
+            _cur = 1 - _cur; _pos = 0;
+            if (_eof) _n[1 - _cur] = 0;
+            else _io = std::thread(&RunReader::fill, this, 1 - _cur); // 预读刚读完的一半
+        }
+        e = _buf[_cur][_pos++];
+        return true;
+    }
+
+    /* 关闭；返回各次读取是否均未出错 */
+    bool close() {
+        if (_io.joinable()) _io.join();
+        if (!_fp) return false;
+        fclose(_fp); _fp = NULL;
+        return _ok;
+    }
+};
+
+/* 输出写入器：一半写满后交给 I/O 线程后台写出，同时继续填写另一半 */
+template <typename T>
+class RunWriter {
+private:
+    FILE* _fp;
+    T* _buf[2];
+    Rank _cap, _n;
+    int _cur;
+    bool _ok;
+    std::thread _io;
+
+    void write(int h, Rank n) { if (fwrite(_buf[h], sizeof(T), n, _fp) != (size_t) n) _ok = false; }
+
+    void flush() {
+        if (_io.joinable()) _io.join();
+        if (_n) _io = std::thread(&RunWriter::write, this, _cur, _n);
+        _cur = 1 - _cur; _n = 0;
+    }
+
+public:
+    RunWriter() : _fp(NULL) {}
+    ~RunWriter() { close(); }
+
+    bool open(const char* path, T* mem, Rank cap) {
+        if (!(_fp = fopen(path, "wb"))) return false;
+        setvbuf(_fp, NULL, _IONBF, 0);
+        _buf[0] = mem; _buf[1] = mem + cap; _cap = cap;
+        _n = 0; _cur = 0; _ok = true;
+        return true;
+    }
+
+    void put(T const& e) { _buf[_cur][_n++] = e; if (_n == _cap) flush(); }
+
+    /* 写出剩余记录并关闭；返回全部写入是否成功 */
+    bool close() {
+        if (!_fp) return false;
+        flush();
+        if (_io.joinable()) _io.join();
+        bool ok = (fclose(_fp) == 0) && _ok;
+        _fp = NULL;
+        return ok;
+    }
+};
+
+/* 外排序：对定长记录文件（T 可平凡复制，按 operator< 排序）排序，内存用量不超过 budget 字节
+   1. 生成归并段：内存三等分，轮流用于预读下一块、排序当前块（Vector::sort）、后台写出上一块
+   2. 多路归并：各段的当前记录组成小顶堆（PQ_ComplHeap），每次取出最小者并补入同段下一条；
+      每段及输出各占两块缓冲区，预读与后台写出与归并计算重叠。
+      段数超过单趟路数上限时，分组归并为更长的段，再进入下一趟
+   以 SORT_MERGE 生成归并段时，相等记录按原文件次序输出（稳定） */
+template <typename T>
+class ExternalSort {
+private:
+    size_t _budget;             // 内存预算（字节）
+    std::string _tmpDir;        // 归并段所在目录
+    SortPolicy _policy;         // 归并段的内排序算法
+    int _serial;                // 归并段编号
+    ExternalSortStats _stats;
+
+    struct Head { // 堆中的段首记录
+        T rec;
+        int run;  // 所属归并段（编号小者在前，保证稳定）
+    };
+    struct HeadAfter { // 堆的“小于”：a 应排在 b 之后
+        bool operator()(Head const& a, Head const& b) const
+        { return (b.rec < a.rec) || (!(a.rec < b.rec) && b.run < a.run); }
+    };
+
+    std::string runPath() {
+        char name[64];
+        snprintf(name, sizeof(name), "/extsort_%p_%d.run", (void*) this, _serial++);
+        return _tmpDir + name;
+    }
+
+    static void writeChunk(const char* path, T const* A, Rank n, bool* ok) {
+        FILE* fp = fopen(path, "wb");
+        *ok = fp && fwrite(A, sizeof(T), n, fp) == (size_t) n;
+        if (fp && fclose(fp) != 0) *ok = false;
+    }
+
+    static void readChunk(FILE* fp, T* A, Rank cap, Rank* n, bool* ok) { if (!readRecords(fp, A, sizeof(T), cap, n)) *ok = false; }
+
+    /* 阶段一：读入、排序并写出各归并段 */
+    bool makeRuns(const char* input, Vector<std::string>& runs) {
+        FILE* in = fopen(input, "rb");
+        if (!in) return false;
+        setvbuf(in, NULL, _IONBF, 0); // 末尾残缺的记录由 readRecords 发现，视为输入有误
+        Rank cap = (Rank) (_budget / 3 / sizeof(T));
+        if (cap < 1) cap = 1;
+        Vector<T> chunk[3] = { Vector<T>(cap, cap, T()), Vector<T>(cap, cap, T()), Vector<T>(cap, cap, T()) };
+        Rank n[3];
+        bool ok = true, written = true, read = true;
+        std::thread reader, writer;
+        int cur = 0;
+        readChunk(in, chunk[cur].data(), cap, &n[cur], &read);
+        while (read && 0 < n[cur]) {
+            int next = (cur + 1) % 3;
+            reader = std::thread(readChunk, in, chunk[next].data(), cap, &n[next], &read); // 预读
+            chunk[cur].sort(0, n[cur], _policy);
+            _stats.records += n[cur];
+            if (writer.joinable()) { writer.join(); ok = ok && written; } // 上一段已写完，其缓冲区可供下次预读
+            runs.insert(runPath());
+            writer = std::thread(writeChunk, runs[runs.size() - 1].c_str(), chunk[cur].data(), n[cur], &written);
+            reader.join();
+            cur = next;
+        }
+        if (writer.joinable()) { writer.join(); ok = ok && written; }
+        fclose(in);
+        return ok && read;
+    }
+
+    /* 将 runs[lo, hi) 归并写入 output */
+    bool mergeRuns(Vector<std::string> const& runs, Rank lo, Rank hi, const char* output, T* mem) {
+        int k = hi - lo;
+        Rank blk = (Rank) (_budget / (2 * (k + 1)) / sizeof(T)); // 每段两块、输出两块
+        if (blk < 1) blk = 1;
+        RunReader<T>* readers = new RunReader<T>[k];
+        RunWriter<T> writer;
+        bool ok = writer.open(output, mem + 2 * k * (size_t) blk, blk);
+        PQ_ComplHeap<Head, HeadAfter> heap;
+        Head h;
+        for (int r = 0; ok && r < k; ++r) {
+            ok = readers[r].open(runs[lo + r].c_str(), mem + 2 * r * (size_t) blk, blk);
+            if (ok && readers[r].next(h.rec)) { h.run = r; heap.push(h); }
+        }
+        while (ok && !heap.empty()) {
+            h = heap.top();
+            writer.put(h.rec);
+            if (readers[h.run].next(h.rec)) heap.replaceTop(h); // 同段下一条接替堆顶
+            else heap.pop();
+        }
+        if (ok) for (int r = 0; r < k; ++r) ok = readers[r].close() && ok; // 读取出错的段会提前“耗尽”，须在此查明
+        delete[] readers;
+        return writer.close() && ok;
+    }
+
+public:
+    ExternalSort(size_t budget, const char* tmpDir = ".", SortPolicy policy = SORT_INTRO)
+        : _budget(budget), _tmpDir(tmpDir), _policy(policy), _serial(0) {
+        static_assert(std::is_trivially_copyable<T>::value, "ExternalSort requires a trivially copyable record type");
+    }
+
+    ExternalSortStats const& stats() const { return _stats; }
+
+    /* 将 input 中的记录排序后写入 output；失败（读写出错，或 input 的长度不是记录长度的整数倍）时
+       返回 false，临时归并段均被删除 */
+    bool sort(const char* input, const char* output) {
+        _stats = ExternalSortStats();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Vector<std::string> runs;
+        bool ok = makeRuns(input, runs);
+        _stats.runs = runs.size();
+        std::chrono::steady_clock::time_point mid = std::chrono::steady_clock::now();
+        _stats.runMs = std::chrono::duration<double, std::milli>(mid - start).count();
+
+        int fanIn = (int) (_budget / (2 * EXTSORT_MIN_BLOCK)) - 1; // 单趟最大路数
+        if (fanIn < 2) fanIn = 2;
+        T* mem = static_cast<T*>(std::malloc(_budget < 6 * sizeof(T) ? 6 * sizeof(T) : _budget)); // 至少容纳两路归并
+        if (!mem) ok = false;
+        while (ok && fanIn < runs.size()) { // 分组归并，直至可一趟完成
+            Vector<std::string> longer;
+            for (Rank lo = 0; lo < runs.size(); lo += fanIn) {
+                Rank hi = (lo + fanIn < runs.size()) ? lo + fanIn : runs.size();
+                longer.insert(runPath());
+                ok = ok && mergeRuns(runs, lo, hi, longer[longer.size() - 1].c_str(), mem);
+                for (Rank r = lo; r < hi; ++r) std::remove(runs[r].c_str()); // 失败时也逐组删除
+            }
+            runs = longer;
+            _stats.passes++;
+        }
+        if (ok) { ok = mergeRuns(runs, 0, runs.size(), output, mem); _stats.passes++; }
+        for (Rank r = 0; r < runs.size(); ++r) std::remove(runs[r].c_str());
+        std::free(mem);
+        _stats.mergeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mid).count();
+        return ok;
+    }
+};
+
+#endif // MYLIBRARY_EXTERNALSORT_H
@@ -14,8 +14,8 @@ protected:  // 改为protected让派生类可以访问
         for (int i = 0; i < n; i++) { // 所有顶点的
             status(i) = UNDISCOVERED; dTime(i) = fTime(i) = -1; // 状态，时间标签
             parent(i) = -1; priority(i) = INT_MAX; // （在遍历树中的）父节点，优先级数
-            for (int j = 0; j < n; j++) // 所有边的
-                if (exists(i, j)) status(i, j) = UNDETERMINED; // 状态
+            for (int j = firstNbr(i); -1 < j; j = nextNbr(i, j)) // 所有边的（逐一枚举邻居，邻接表实现下为O(n + e)）
+                status(i, j) = UNDETERMINED; // 状态
         }
     }
     void BFS(int, int&); // （连通域）广度优先搜索算法
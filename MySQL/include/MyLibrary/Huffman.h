@@ -3,6 +3,7 @@
 
 #include "BinTree.h"
 #include "Bitmap.h"
+#include "PQ_ComplHeap.h"
 #include <string>
 #include <map>
 #include <vector>
@@ -70,6 +71,10 @@ public:
     }
 };
 
+struct HuffTreeHeavier { // 权重较大者视作“较小”，从而堆顶总是最轻的树
+    bool operator()(HuffTree* t1, HuffTree* t2) const { return t1->weight() > t2->weight(); }
+};
+
 class HuffCode {
 private:
     map<char, string> _codeTable;
@@ -170,7 +175,7 @@ class HuffmanEncoder {
 private:
     string _text;
     map<char, int> _freqTable;
-    vector<HuffTree*> _forest;
+    PQ_ComplHeap<HuffTree*, HuffTreeHeavier> _forest; // 以权重为优先级的森林
     HuffTree* _huffTree;
     HuffCode _huffCode;
 
@@ -197,43 +202,17 @@ public:
     void buildHuffmanTree() {
         // 创建初始森林
         for (const auto& pair : _freqTable) {
-            _forest.push_back(new HuffTree(pair.first, pair.second));
+            _forest.push(new HuffTree(pair.first, pair.second));
         }
         
-        // 构建Huffman树
+        // 构建Huffman树：反复取出权重最小的两棵树合并
         while (_forest.size() > 1) {
-            // 找到权重最小的两棵树
-            int min1 = 0, min2 = 1;
-            if (_forest.size() > 1 && _forest[min1]->weight() > _forest[min2]->weight()) {
-                std::swap(min1, min2);  // 使用 std::swap
-            }
-            
-            for (size_t i = 2; i < _forest.size(); ++i) {
-                if (_forest[i]->weight() < _forest[min1]->weight()) {
-                    min2 = min1;
-                    min1 = i;
-                } else if (_forest[i]->weight() < _forest[min2]->weight()) {
-                    min2 = i;
-                }
-            }
-            
-            // 合并两棵树
-            HuffTree* newTree = HuffTree::merge(_forest[min1], _forest[min2]);
-            
-            // 从森林中移除被合并的树
-            if (min1 < min2) {
-                _forest.erase(_forest.begin() + min2);
-                _forest.erase(_forest.begin() + min1);
-            } else {
-                _forest.erase(_forest.begin() + min1);
-                _forest.erase(_forest.begin() + min2);
-            }
-            
-            // 添加新树
-            _forest.push_back(newTree);
+            HuffTree* t1 = _forest.pop();
+            HuffTree* t2 = _forest.pop();
+            _forest.push(HuffTree::merge(t1, t2));
         }
         
-        _huffTree = _forest.empty() ? NULL : _forest[0];
+        _huffTree = _forest.empty() ? NULL : _forest.pop();
     }
     
     Bitmap* encodeText() {
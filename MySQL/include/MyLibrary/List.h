@@ -2,25 +2,36 @@
 #define MYLIBRARY_LIST_H
 
 #include "ListNode.h" // 引入列表节点类
+#include "Dedup.h" // 散列去重
+#include "OpStats.h" // 操作计数
+#include "NodePool.h" // 节点分配策略
 
-template <typename T> class List { // 列表模板类
+#define LIST_MIN_RUN 16 // 自然归并排序中，短于此的有序段以插入排序补足至此长度
+
+template <typename T, typename Alloc = NodePool<ListNode<T> > > class List { // 列表模板类，Alloc 为节点分配策略
 private:
     int _size; ListNodePosi(T) header; ListNodePosi(T) trailer; // 规模、头哨兵、尾哨兵
+    Alloc _alloc; // 节点分配器（缺省为节点池，各节点取自连续的大块，删除后回收复用）
 
 protected:
     void init(); // 列表创建时的初始化
     int clear(); // 清除所有节点
     void copyNodes(ListNodePosi(T), int); // 复制列表中自位置p起的n项
-    void merge(ListNodePosi(T)&, int, List<T>&, ListNodePosi(T), int); // 归并
+    static void relink(ListNodePosi(T), ListNodePosi(T), ListNodePosi(T)); // 将[first, last]诸节点摘下，接入p之前
+    void merge(ListNodePosi(T)&, int, List&, ListNodePosi(T), int); // 归并
     void mergeSort(ListNodePosi(T)&, int); // 对从p开始连续的n个节点归并排序
+    void naturalMergeSort(ListNodePosi(T)&, int); // 对从p开始连续的n个节点自底向上自然归并排序
     void selectionSort(ListNodePosi(T), int); // 对从p开始连续的n个节点选择排序
     void insertionSort(ListNodePosi(T), int); // 对从p开始连续的n个节点插入排序
+    int deduplicate(std::true_type) { return deduplicate(std::hash<T>(), std::equal_to<T>()); } // 可散列
+    int deduplicate(std::false_type); // 不可散列：逐一比对
 
 public:
     // 构造函数
     List() { init(); } // 默认
-    List(List<T> const& L); // 整体复制列表L
-    List(List<T> const& L, Rank r, int n); // 复制列表L中自第r项起的n项
+    explicit List(Alloc const& alloc) : _alloc(alloc) { init(); } // 指定分配器（如与其它列表共享节点池）
+    List(List const& L); // 整体复制列表L
+    List(List const& L, Rank r, int n); // 复制列表L中自第r项起的n项
     List(ListNodePosi(T) p, int n); // 复制列表中自位置p起的n项
 
     // 析构函数
@@ -28,6 +39,7 @@ public:
 
     // 只读访问接口
     Rank size() const { return _size; } // 规模
+    Alloc const& allocator() const { return _alloc; } // 节点分配器（节点池可由此查询占用统计）
     bool empty() const { return _size <= 0; } // 判空
     T& operator[](Rank r) const; // 重载，支持循秩访问（效率低）
     ListNodePosi(T) first() const { return header->succ; } // 首节点位置
@@ -50,10 +62,15 @@ public:
     ListNodePosi(T) insertBefore(ListNodePosi(T) p, T const& e); // 将e当作p的前驱插入
     ListNodePosi(T) insertAfter(ListNodePosi(T) p, T const& e); // 将e当作p的后继插入
     T remove(ListNodePosi(T) p); // 删除合法位置p处的节点，返回被删除节点
-    void merge(List<T>& L) { merge(first(), _size, L, L.first(), L._size); } // 全列表归并
-    void sort(ListNodePosi(T) p, int n); // 列表区间排序
+    void merge(List& L) { ListNodePosi(T) p = first(); merge(p, _size, L, L.first(), L._size); } // 全列表归并
+    void splice(ListNodePosi(T) p, List& L, ListNodePosi(T) first, ListNodePosi(T) last, int n); // 将L中[first, last)诸节点（共n个）移至p之前，O(1)；跨列表时两者此后共享节点池
+    void splice(ListNodePosi(T) p, List& L, ListNodePosi(T) first, ListNodePosi(T) last); // 同上，跨列表时须先清点节点数
+    void splice(ListNodePosi(T) p, List& L, ListNodePosi(T) q) { splice(p, L, q, q->succ, 1); } // 将L中节点q移至p之前
+    void splice(ListNodePosi(T) p, List& L) { splice(p, L, L.first(), L.trailer, L._size); } // 将L的全部节点移至p之前
+    void sort(ListNodePosi(T) p, int n) { naturalMergeSort(p, n); } // 列表区间排序（稳定，有序或逆序输入O(n)）
     void sort() { sort(first(), _size); } // 列表整体排序
-    int deduplicate(); // 无序去重
+    int deduplicate() { return deduplicate(typename HasStdHash<T>::type()); } // 无序去重，保留首次出现者
+    template <typename Hash, typename Eq> int deduplicate(Hash hash, Eq eq); // 散列去重，指定散列与判等函数对象
     int uniquify(); // 有序去重
     void reverse(); // 前后倒置
 
@@ -63,104 +80,139 @@ public:
 };
 
 // List 成员函数实现
-template <typename T> void List<T>::init() { //列表刜始化，在创建列表对象时统一调用
-    header = new ListNode<T>; //创建头哨兵节点
-    trailer = new ListNode<T>; //创建尾哨兵节点
+template <typename T, typename A> void List<T, A>::init() { //列表刜始化，在创建列表对象时统一调用
+    header = _alloc.create(); //创建头哨兵节点
+    trailer = _alloc.create(); //创建尾哨兵节点
     header->succ = trailer; header->pred = NULL;
     trailer->pred = header; trailer->succ = NULL;
     _size = 0; //记录规模
 }
 
-template <typename T> //重载下标操作符，以通过秩直接讵问列表节点（虽斱便，效率低，需慎用）
-T& List<T>::operator[](Rank r) const { //assert: 0 <= r < size
+template <typename T, typename A> //重载下标操作符，以通过秩直接讵问列表节点（虽斱便，效率低，需慎用）
+T& List<T, A>::operator[](Rank r) const { //assert: 0 <= r < size
     ListNodePosi(T) p = first(); //从首节点出収
     while (0 < r--) p = p->succ; //顸数第r个节点即是
     return p->data; //目标节点，迒回其中所存元素
 }
 
-template <typename T> //在无序列表内节点p（可能是trailer）癿n个（真）前驱中，找刡等亍e癿最后者
-ListNodePosi(T) List<T>::find(T const& e, int n, ListNodePosi(T) p) const { //0<=n<=rank(p)<_size
+template <typename T, typename A> //在无序列表内节点p（可能是trailer）癿n个（真）前驱中，找刡等亍e癿最后者
+ListNodePosi(T) List<T, A>::find(T const& e, int n, ListNodePosi(T) p) const { //0<=n<=rank(p)<_size
     while (0 < n--) //对亍p癿最近癿n个前驱，从右向左
         if (e == (p = p->pred)->data) return p; //逐个比对，直至命中戒范围越界
     return NULL; //p越出左边界意味着匙间内丌含e，查找失败
 } //失败时，迒回NULL
 
-template <typename T> ListNodePosi(T) List<T>::insertAsFirst(T const& e)
-{ _size++; return header->insertAsSucc(e); } //e当作首节点揑入
+template <typename T, typename A> ListNodePosi(T) List<T, A>::insertAsFirst(T const& e)
+{ _size++; return header->insertAsSucc(e, _alloc); } //e当作首节点揑入
 
-template <typename T> ListNodePosi(T) List<T>::insertAsLast(T const& e)
-{ _size++; return trailer->insertAsPred(e); } //e当作末节点揑入
+template <typename T, typename A> ListNodePosi(T) List<T, A>::insertAsLast(T const& e)
+{ _size++; return trailer->insertAsPred(e, _alloc); } //e当作末节点揑入
 
-template <typename T> ListNodePosi(T) List<T>::insertBefore(ListNodePosi(T) p, T const& e)
-{ _size++; return p->insertAsPred(e); } //e当作p的前驱揑入
+template <typename T, typename A> ListNodePosi(T) List<T, A>::insertBefore(ListNodePosi(T) p, T const& e)
+{ _size++; return p->insertAsPred(e, _alloc); } //e当作p的前驱揑入
 
-template <typename T> ListNodePosi(T) List<T>::insertAfter(ListNodePosi(T) p, T const& e)
-{ _size++; return p->insertAsSucc(e); } //e当作p的后继揑入
+template <typename T, typename A> ListNodePosi(T) List<T, A>::insertAfter(ListNodePosi(T) p, T const& e)
+{ _size++; return p->insertAsSucc(e, _alloc); } //e当作p的后继揑入
 
-template <typename T> //将e紧靠当前节点之前揑入于当前节点所属列表（设有哨兵头节点header）
-ListNodePosi(T) ListNode<T>::insertAsPred(T const& e) {
-    ListNodePosi(T) x = new ListNode(e, pred, this); //创建新节点
+template <typename T> template <typename Alloc> //将e紧靠当前节点之前揑入于当前节点所属列表（设有哨兵头节点header）
+ListNodePosi(T) ListNode<T>::insertAsPred(T const& e, Alloc& alloc) {
+    ListNodePosi(T) x = alloc.create(e, pred, this); //创建新节点
     pred->succ = x; pred = x; //设置正向链接
     return x; //返回新节点的位置
 }
 
-template <typename T> //将e紧随当前节点之后揑入于弼前节点所属列表（设有哨兵尾节点trailer）
-ListNodePosi(T) ListNode<T>::insertAsSucc(T const& e) {
-    ListNodePosi(T) x = new ListNode(e, this, succ); //创建新节点
+template <typename T> template <typename Alloc> //将e紧随当前节点之后揑入于弼前节点所属列表（设有哨兵尾节点trailer）
+ListNodePosi(T) ListNode<T>::insertAsSucc(T const& e, Alloc& alloc) {
+    ListNodePosi(T) x = alloc.create(e, this, succ); //创建新节点
     succ->pred = x; succ = x; //设置逆向链接
     return x; //返回新节点的位置
 }
 
-template <typename T> //列表内部方法：复置列表中自位置p起的n项
-void List<T>::copyNodes(ListNodePosi(T) p, int n) { //p合法，且至少有n-1个真后继节点
+template <typename T, typename A> //列表内部方法：复置列表中自位置p起的n项
+void List<T, A>::copyNodes(ListNodePosi(T) p, int n) { //p合法，且至少有n-1个真后继节点
     init(); //创建头、尾哨兵节点开做初始化
     while(n--) { insertAsLast(p->data); p = p->succ; } //将起自p的n项依次作为末节点揑入
 }
 
-template <typename T> //assert: p为合法位置，且至少有n-1个后继节点
-List<T>::List(ListNodePosi(T) p, int n) { copyNodes(p, n); } //复制列表中自位置p起的n项
+template <typename T, typename A> //assert: p为合法位置，且至少有n-1个后继节点
+List<T, A>::List(ListNodePosi(T) p, int n) { copyNodes(p, n); } //复制列表中自位置p起的n项
+
+template <typename T, typename A>
+List<T, A>::List(List<T, A> const& L) { copyNodes(L.first(), L._size); } //整体复刢列表L
+
+template <typename T, typename A> //assert: r+n <= L._size
+List<T, A>::List(List<T, A> const& L, int r, int n) { copyNodes(L[r], n); } //复制L中自第r项起的n项
+
+template <typename T, typename A> //将[first, last]诸节点（p不在其中）摘下，整段接入p之前
+void List<T, A>::relink(ListNodePosi(T) p, ListNodePosi(T) first, ListNodePosi(T) last) {
+    first->pred->succ = last->succ; last->succ->pred = first->pred; //原处前后相接
+    first->pred = p->pred; last->succ = p; //接入p之前
+    p->pred->succ = first; p->pred = last;
+}
 
-template <typename T>
-List<T>::List(List<T> const& L) { copyNodes(L.first(), L._size); } //整体复刢列表L
+template <typename T, typename A> //节点转移：不分配、不释放节点，亦不复制元素
+void List<T, A>::splice(ListNodePosi(T) p, List<T, A>& L, ListNodePosi(T) first, ListNodePosi(T) last, int n) {
+    if (first == last) return; //空区间
+    if (this != &L) _alloc.join(L._alloc); //转入的节点须能由本列表回收：合并双方的节点池（已共享时无操作）
+    relink(p, first, last->pred);
+    if (this != &L) { _size += n; L._size -= n; } //同一列表内转移，规模不变
+}
 
-template <typename T> //assert: r+n <= L._size
-List<T>::List(List<T> const& L, int r, int n) { copyNodes(L[r], n); } //复制L中自第r项起的n项
+template <typename T, typename A>
+void List<T, A>::splice(ListNodePosi(T) p, List<T, A>& L, ListNodePosi(T) first, ListNodePosi(T) last) {
+    int n = 0;
+    if (this != &L) for (ListNodePosi(T) q = first; q != last; q = q->succ) n++; //O(n)
+    splice(p, L, first, last, n);
+}
 
-template <typename T> T List<T>::remove(ListNodePosi(T) p) { //删除合法位置p处节点，返回其数值
+template <typename T, typename A> T List<T, A>::remove(ListNodePosi(T) p) { //删除合法位置p处节点，返回其数值
     T e = p->data; //备份待删除节点的数值（假定T类型可直接赋值）
     p->pred->succ = p->succ; p->succ->pred = p->pred; //后继、前驱
-    delete p; _size--; //释放节点，更新规模
+    _alloc.destroy(p); _size--; //释放节点，更新规模
     return e; //返回备份的数值
 }
 
-template <typename T> List<T>::~List() //列表析构器
-{ clear(); delete header; delete trailer; } //清空列表，释放头、尾哨兵节点
+template <typename T, typename A> List<T, A>::~List() //列表析构器
+{ clear(); _alloc.destroy(header); _alloc.destroy(trailer); } //清空列表，释放头、尾哨兵节点
 
-template <typename T> int List<T>::clear() { //清空列表
+template <typename T, typename A> int List<T, A>::clear() { //清空列表
     int oldSize = _size;
     while (0 < _size) remove(header->succ); //反复删除首节点，直至列表发空
     return oldSize;
 }
 
-template <typename T> int List<T>::deduplicate() { //剔除无序列表中的重复节点
+template <typename T, typename A> template <typename Hash, typename Eq> //散列去重：节点不动，散列表登记各首次出现者
+int List<T, A>::deduplicate(Hash hash, Eq eq) { //O(n)
     if (_size < 2) return 0; //平凡列表自然无重复
     int oldSize = _size; //记录原规模
-    ListNodePosi(T) p = header; Rank r = 0; //p从首节点开始
-    while (trailer != (p = p->succ)) { //依次直到末节点
-        ListNodePosi(T) q = find(p->data, r, p); //在p的r个（真）前驱中查找雷同者
-        q ? remove(q) : r++; //若的确存在，则删除之；否则秩加一
+    DedupTable<T, Hash, Eq> seen(_size, hash, eq);
+    for (ListNodePosi(T) p = header->succ; trailer != p; ) { //自前向后逐一登记
+        ListNodePosi(T) q = p; p = p->succ;
+        if (!seen.insert(q->data)) remove(q); //已有雷同者，则删除当前节点
+    }
+    return oldSize - _size; //列表规模变化量，即被删除元素总数
+}
+
+template <typename T, typename A> int List<T, A>::deduplicate(std::false_type) { //剔除无序列表中的重复节点
+    if (_size < 2) return 0; //平凡列表自然无重复
+    int oldSize = _size; //记录原规模
+    ListNodePosi(T) p = header->succ; Rank r = 0; //p从首节点开始
+    while (trailer != p) { //依次直到末节点
+        ListNodePosi(T) q = p; p = p->succ;
+        if (find(q->data, r, q)) remove(q); //在q的r个（真）前驱中查找雷同者，若存在则删除q（保留首次出现者）
+        else r++; //否则秩加一
     } //assert: 循环过程中的任意时刻，p癿所有前驱互不相同
     return oldSize - _size; //列表规模发化量，即被删除元素总数
 }
 
-template <typename T> void List<T>::traverse(void (*visit)(T&)) //利用函数指针机制的遍历
+template <typename T, typename A> void List<T, A>::traverse(void (*visit)(T&)) //利用函数指针机制的遍历
 { for (ListNodePosi(T) p = header->succ; p != trailer; p = p->succ) visit(p->data); }
 
-template <typename T> template <typename VST> //元素类型、操作器
-void List<T>::traverse(VST& visit) //利用函数对象机制的遍历
+template <typename T, typename A> template <typename VST> //元素类型、操作器
+void List<T, A>::traverse(VST& visit) //利用函数对象机制的遍历
 { for (ListNodePosi(T) p = header->succ; p != trailer; p = p->succ) visit(p->data); }
 
-template <typename T> int List<T>::uniquify() { //成批剔除重复元素，效率更高
+template <typename T, typename A> int List<T, A>::uniquify() { //成批剔除重复元素，效率更高
     if (_size < 2) return 0; //平凡列表自然无重复
     int oldSize = _size; //记录原规模
     ListNodePosi(T) p; ListNodePosi(T) q; //依次指向紧邻的各对节点
@@ -169,8 +221,8 @@ template <typename T> int List<T>::uniquify() { //成批剔除重复元素，效
     return oldSize - _size; //列表规模变化量，即被删除元素总数
 }
 
-template <typename T> //在有序列表内节点p（可能是trailer）的n个（真）前驱中，找到不大于e的最后者
-ListNodePosi(T) List<T>::search(T const& e, int n, ListNodePosi(T) p) const {
+template <typename T, typename A> //在有序列表内节点p（可能是trailer）的n个（真）前驱中，找到不大于e的最后者
+ListNodePosi(T) List<T, A>::search(T const& e, int n, ListNodePosi(T) p) const {
 // assert: 0 <= n <= rank(p) < _size
     while (0 <= n--) //对于p的最近的n个前驱，从右向左逐个比较
         if (((p = p->pred)->data) <= e) break; //直至命中、数值越界或范围越界
@@ -178,44 +230,37 @@ ListNodePosi(T) List<T>::search(T const& e, int n, ListNodePosi(T) p) const {
     return p; //返回查找终止的位置
 } //失败时，返回区间左边界的前驱（可能是header）——调用者可通过valid()判断成功与否
 
-template <typename T> void List<T>::sort(ListNodePosi(T) p, int n) { //列表区间排序
-    switch (rand() % 3) { //随机选取排序算法。可根据具体问题的特点灵活选取或扩充
-        case 1: insertionSort(p, n); break; //插入排序
-        case 2: selectionSort(p, n); break; //选择排序
-        default: mergeSort(p, n); break; //归并排序
-    }
-}
-
-template <typename T> //列表的插入排序算法：对起始于位置p的n个元素排序
-void List<T>::insertionSort(ListNodePosi(T) p, int n) { //valid(p) && rank(p) + n <= size
+template <typename T, typename A> //列表的插入排序算法：对起始于位置p的n个元素排序
+void List<T, A>::insertionSort(ListNodePosi(T) p, int n) { //valid(p) && rank(p) + n <= size
     for (int r = 0; r < n; r++) { //逐一为各节点
-        insertAfter(search(p->data, r, p), p->data); //查找适当的位置并插入
-        p = p->succ; remove(p->pred); //转向下一节点
+        ListNodePosi(T) q = search(p->data, r, p)->succ; //查找适当的位置
+        p = p->succ; //转向下一节点
+        if (q != p->pred) relink(q, p->pred, p->pred); //将当前节点移至该位置
     }
 }
 
-template <typename T> //列表的选择排序算法：对起始于位置p的n个元素排序
-void List<T>::selectionSort(ListNodePosi(T) p, int n) { //valid(p) && rank(p) + n <= size
+template <typename T, typename A> //列表的选择排序算法：对起始于位置p的n个元素排序
+void List<T, A>::selectionSort(ListNodePosi(T) p, int n) { //valid(p) && rank(p) + n <= size
     ListNodePosi(T) head = p->pred; ListNodePosi(T) tail = p;
     for (int i = 0; i < n; i++) tail = tail->succ; //待排序区间为(head, tail)
     while (1 < n) { //在至少还剩两个节点之前，在待排序区间内
         ListNodePosi(T) max = selectMax(head->succ, n); //找出最大者（歧义时后者优先）
-        insertBefore(tail, remove(max)); //将其移动至无序区间末尾（作为有序区间新的首元素）
-        tail = tail->pred; n--;
+        if (max->succ != tail) relink(tail, max, max); //将其移动至无序区间末尾（作为有序区间新的首元素）
+        tail = max; n--;
     }
 }
 
-template <typename T> //从起始于位置p的n个元素中选出最大者
-ListNodePosi(T) List<T>::selectMax(ListNodePosi(T) p, int n) {
+template <typename T, typename A> //从起始于位置p的n个元素中选出最大者
+ListNodePosi(T) List<T, A>::selectMax(ListNodePosi(T) p, int n) {
     ListNodePosi(T) max = p; //最大者暂定为首节点p
     for (ListNodePosi(T) cur = p; 1 < n; n--) //从首节点p出収，将后续节点逐一与max比较
-        if (!lt((cur = cur->succ)->data, max->data)) //若当前元素不小于max，则
+        if (!((cur = cur->succ)->data < max->data)) //若当前元素不小于max，则
             max = cur; //更新最大元素位置记录
     return max; //返回最大节点位置
 }
 
-template <typename T> //有序列表的归并：当前列表中自p起的n个元素，与列表L中自q起的m个元素归并
-void List<T>::merge(ListNodePosi(T)& p, int n, List<T>& L, ListNodePosi(T) q, int m) {
+template <typename T, typename A> //有序列表的归并：当前列表中自p起的n个元素，与列表L中自q起的m个元素归并
+void List<T, A>::merge(ListNodePosi(T)& p, int n, List<T, A>& L, ListNodePosi(T) q, int m) {
 // assert: this.valid(p) && rank(p) + n <= size && this.sorted(p, n)
 // L.valid(q) && rank(q) + m <= L._size && L.sorted(q, m)
 // 注意：在归并排序之类的场合，有可能 this == L && rank(p) + n = rank(q)
@@ -224,12 +269,12 @@ void List<T>::merge(ListNodePosi(T)& p, int n, List<T>& L, ListNodePosi(T) q, in
         if ((0 < n) && (p->data <= q->data)) //若p仍在区间内且v(p) <= v(q)，则
             { if (q == (p = p->succ)) break; n--; } //将p替换为其直接后继（等效于将p归入合并的列表）
         else //若p已超出右界或v(q) < v(p)，则
-            { insertBefore(p, L.remove((q = q->succ)->pred)); m--; } //将q转移至p之前
+            { q = q->succ; splice(p, L, q->pred, q, 1); m--; } //将q转移至p之前（仅调整链接）
     p = pp->succ; //确定归并后区间的（新）起点
 }
 
-template <typename T> //列表的归并排序算法：对起始于位置p的n个元素排序
-void List<T>::mergeSort(ListNodePosi(T)& p, int n) { //valid(p) && rank(p) + n <= size
+template <typename T, typename A> //列表的归并排序算法：对起始于位置p的n个元素排序
+void List<T, A>::mergeSort(ListNodePosi(T)& p, int n) { //valid(p) && rank(p) + n <= size
     if (n < 2) return; //若待排序范围已足够小，则直接返回；否则...
     int m = n >> 1; //以中点为界
     ListNodePosi(T) q = p; for (int i = 0; i < m; i++) q = q->succ; //均分列表
@@ -237,4 +282,35 @@ void List<T>::mergeSort(ListNodePosi(T)& p, int n) { //valid(p) && rank(p) + n <
     merge(p, m, *this, q, n - m); //归并
 } //注意：排序后，p依然指向归并后区间的（新）起点
 
+template <typename T, typename A> //自然归并排序：对起始于位置p的n个元素排序，不递归，亦无需为找中点而遍历
+void List<T, A>::naturalMergeSort(ListNodePosi(T)& p, int n) { //valid(p) && rank(p) + n <= size
+    if (n < 2) return;
+    ListNodePosi(T) head = p->pred; //区间之前的节点（可能是header），排序中不动
+    ListNodePosi(T) run[64]; int len[64]; int k = 0; //待归并的有序段（首节点、长度）栈，自底向上长度按Fibonacci式递减
+    for (ListNodePosi(T) q = p; 0 < n; ) {
+        ListNodePosi(T) pre = q->pred; ListNodePosi(T) x = q->succ; int r = 1; //识别自q起的有序段，x为其后第一个节点
+        if (1 < n && x->data < q->data) { //严格递减段：q之后者逐个移至段首，即为倒置（严格递减故不破坏稳定性）
+            while (r < n && q->succ->data < pre->succ->data) { relink(pre->succ, q->succ, q->succ); r++; }
+            x = q->succ;
+        } else
+            while (r < n && !(x->data < x->pred->data)) { x = x->succ; r++; } //非降段
+        if (r < LIST_MIN_RUN && r < n) { //过短的段以插入排序补足
+            int m = (LIST_MIN_RUN < n) ? LIST_MIN_RUN : n;
+            for (int i = r; i < m; i++) x = x->succ;
+            insertionSort(pre->succ, m); r = m;
+        }
+        run[k] = pre->succ; len[k++] = r; q = x; n -= r;
+        while (1 < k) { //维持 len[i - 2] > len[i - 1] + len[i] 且 len[i - 1] > len[i]，否则归并相邻两段
+            int i = k - 2; //默认归并栈顶两段
+            if ((0 < i && len[i - 1] <= len[i] + len[i + 1]) || (1 < i && len[i - 2] <= len[i - 1] + len[i])) {
+                if (len[i - 1] < len[i + 1]) i--; //与较短的邻段归并
+            } else if (len[i + 1] < len[i]) break;
+            merge(run[i], len[i], *this, run[i + 1], len[i + 1]); len[i] += len[i + 1];
+            for (k--, i++; i < k; i++) { run[i] = run[i + 1]; len[i] = len[i + 1]; }
+        }
+    }
+    for (; 1 < k; k--) { merge(run[k - 2], len[k - 2], *this, run[k - 1], len[k - 1]); len[k - 2] += len[k - 1]; } //自栈顶起逐段归并
+    p = head->succ; //排序后区间的（新）起点
+}
+
 #endif // MYLIBRARY_LIST_H  
\ No newline at end of file
@@ -14,8 +14,8 @@ template <typename T> struct ListNode { // 列表节点模板类（以双向链
         : data(e), pred(p), succ(s) {} // 默认构造器
 
     // 操作接口
-    ListNodePosi(T) insertAsPred(T const& e); // 紧靠当前节点之前插入新节点
-    ListNodePosi(T) insertAsSucc(T const& e); // 紧随当前节点之后插入新节点
+    template <typename Alloc> ListNodePosi(T) insertAsPred(T const& e, Alloc& alloc); // 紧靠当前节点之前插入新节点（由alloc创建）
+    template <typename Alloc> ListNodePosi(T) insertAsSucc(T const& e, Alloc& alloc); // 紧随当前节点之后插入新节点（由alloc创建）
 };
 
 
@@ -0,0 +1,128 @@
+#ifndef MYLIBRARY_MAPPEDVECTOR_H
+#define MYLIBRARY_MAPPEDVECTOR_H
+
+#include "Vector.h"
+#include "VectorFile.h"
+#include <limits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* 内存映射向量：以只读方式映射 Vector::saveTo 写出的文件，元素不经复制直接访问
+   - 打开时只检查文件头（标识、版本、元素大小、文件长度），耗时与规模无关；
+     数据区校验和须逐字节扫描，由 verify() 按需完成
+   - 提供 Vector 的只读查询接口；需要可写副本时，以 Vector<T>(M.data(), M.size()) 整体复制 */
+template <typename T>
+class MappedVector {
+private:
+    Rank _size;                 // 元素数
+    T const* _elem;             // 数据区（映射内存中）
+    void* _base;                // 映射首地址
+    size_t _length;             // 映射长度
+#ifdef _WIN32
+    HANDLE _file, _mapping;
+#endif
+
+    MappedVector(MappedVector const&) = delete;
+    MappedVector& operator=(MappedVector const&) = delete;
+
+    VectorFileHeader const* header() const { return static_cast<VectorFileHeader const*>(_base); }
+
+    /* 映射整个文件，成功后 _base、_length 有效 */
+    bool map(const char* path) {
+#ifdef _WIN32
+        _file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (_file == INVALID_HANDLE_VALUE) { _file = NULL; return false; }
+        LARGE_INTEGER len;
+        if (!GetFileSizeEx(_file, &len) || len.QuadPart < (LONGLONG) sizeof(VectorFileHeader)) return false;
+        _length = (size_t) len.QuadPart;
+        _mapping = CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!_mapping) return false;
+        _base = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+        return _base != NULL;
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(VectorFileHeader)) { ::close(fd); return false; }
+        _length = (size_t) st.st_size;
+        void* p = mmap(NULL, _length, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // 映射建立后即可关闭文件描述符
+        if (p == MAP_FAILED) return false;
+        _base = p;
+        return true;
+#endif
+    }
+
+public:
+    MappedVector() : _size(0), _elem(NULL), _base(NULL), _length(0)
+#ifdef _WIN32
+        , _file(NULL), _mapping(NULL)
+#endif
+    { static_assert(std::is_trivially_copyable<T>::value, "MappedVector requires a trivially copyable element type"); }
+    explicit MappedVector(const char* path) : MappedVector() { open(path); }
+    ~MappedVector() { close(); }
+
+    /* 打开并映射文件；文件头不符、长度不足或元素数超出 Rank 的范围时返回 false */
+    bool open(const char* path) {
+        close();
+        if (!map(path)) { close(); return false; }
+        VectorFileHeader const* h = header();
+        if (std::memcmp(h->magic, VECTOR_FILE_MAGIC, sizeof(h->magic)) != 0 || h->version != VECTOR_FILE_VERSION
+            || h->elemSize != sizeof(T) || h->count > (uint64_t) ((_length - sizeof(VectorFileHeader)) / sizeof(T))
+            || h->count > (uint64_t) std::numeric_limits<Rank>::max()) {
+            close(); return false;
+        }
+        _size = (Rank) h->count;
+        _elem = reinterpret_cast<T const*>(static_cast<const char*>(_base) + sizeof(VectorFileHeader));
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (_base) UnmapViewOfFile(_base);
+        if (_mapping) CloseHandle(_mapping);
+        if (_file) CloseHandle(_file);
+        _file = _mapping = NULL;
+#else
+        if (_base) munmap(_base, _length);
+#endif
+        _base = NULL; _elem = NULL; _length = 0; _size = 0;
+    }
+
+    bool valid() const { return _base != NULL; }
+
+    /* 逐字节核对数据区校验和 */
+    bool verify() const { return valid() && vectorChecksum(_elem, sizeof(T) * _size) == header()->checksum; }
+
+    /* 只读访问接口 */
+    Rank size() const { return _size; }
+    bool empty() const { return !_size; }
+    T const& operator[](Rank r) const { return _elem[r]; }
+    T const* data() const { return _elem; }
+    int disordered() const { return scanDisordered(_elem, _size); } // 相邻逆序对数
+    Rank find(T const& e) const { return find(e, 0, _size); }
+    Rank find(T const& e, Rank lo, Rank hi) const { return scanFind(_elem, e, lo, hi); } // 无序区间查找
+    T min() const { return scanMin(_elem, _size); }
+    T max() const { return scanMax(_elem, _size); }
+    typename SumOf<T>::type sum() const { return scanSum(_elem, _size); }
+    Rank search(T const& e) const { return search(e, 0, _size); }
+    Rank search(T const& e, Rank lo, Rank hi) const // 有序区间查找
+    { return binSearch(_elem, e, lo, hi); }
+
+    /* 遍历（只读） */
+    void traverse(void (*visit)(T const&)) const { for (Rank i = 0; i < _size; ++i) visit(_elem[i]); }
+    template <typename VST>
+    void traverse(VST& visit) const { for (Rank i = 0; i < _size; ++i) visit(_elem[i]); }
+};
+
+#endif // MYLIBRARY_MAPPEDVECTOR_H
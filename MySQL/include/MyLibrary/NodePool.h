@@ -0,0 +1,157 @@
+#ifndef MYLIBRARY_NODEPOOL_H
+#define MYLIBRARY_NODEPOOL_H
+
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include "OpStats.h"
+
+#define NODEPOOL_FIRST_CHUNK 32     // 首块所含节点数
+#define NODEPOOL_MAX_CHUNK 4096     // 每块至多所含节点数（块长逐次倍增至此为止）
+
+/* 节点池统计 */
+struct NodePoolStats {
+    long long chunks;   // 已申请的块数
+    long long capacity; // 各块所含节点总数
+    long long inUse;    // 在用节点数
+    long long peak;     // 在用节点数的峰值
+    long long bytes;    // 各块总字节数
+    double occupancy() const { return capacity ? double(inUse) / capacity : 0.0; } // 占用率
+};
+
+/* 节点分配策略：create(args...) 构造一个节点并返回其地址，destroy(p) 析构并回收之；
+   join(b) 使此后两者相等，彼此所建节点可互相回收（供容器间转移节点） */
+
+/* 逐个 new/delete */
+template <typename Node>
+class HeapNodeAllocator {
+public:
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(Node));
+        return new Node(std::forward<Args>(args)...);
+    }
+    void destroy(Node* p) { delete p; }
+    void join(HeapNodeAllocator&) {} // 本就相等
+    bool operator==(HeapNodeAllocator const&) const { return true; } // 任一实例所建节点均可交由其它实例回收
+    bool operator!=(HeapNodeAllocator const&) const { return false; }
+};
+
+/* 节点池：从连续的大块中逐个切分节点，回收的节点挂入空闲链表，优先复用
+   - 块长自 NODEPOOL_FIRST_CHUNK 起倍增，至多 NODEPOOL_MAX_CHUNK，空间随池销毁一并释放
+   - 池对象仅为句柄：复制句柄即共享同一个池，默认构造则新建一个池；
+     共享同一池的句柄相等，彼此所建节点可互相回收
+   - join 将两个池合并为一个：块、空闲链表与统计并入其一，另一个只留作转发，其句柄于下次
+     使用时改指合并后的池。列表间转移节点前以此合并，此后双方的节点可互相回收
+   - 不加锁，共享同一池（包括经 join 合并）的容器须在同一线程中使用 */
+template <typename Node>
+class NodePool {
+private:
+    union Slot { // 空闲时存放链接，使用时存放节点
+        Slot* next;
+        typename std::aligned_storage<sizeof(Node), alignof(Node)>::type node;
+    };
+    struct Chunk { Chunk* next; }; // 块首，其后为若干 Slot
+
+    struct Pool {
+        Pool* into;         // 已并入的池（非空时本池不再持有任何空间，仅作转发）
+        Slot* free;         // 空闲链表
+        Slot* cursor;       // 当前块中尚未切分部分的起点
+        Slot* end;          // 当前块的终点
+        Chunk* chunks;      // 所有块（单链）
+        Chunk* chunksTail;  // 最早申请的块，即块链的末节点
+        NodePoolStats stats;
+        std::vector<Slot*> spare;   // 并入的池各自的空闲链表，本池空闲链表及当前块用尽后依次取用
+        std::shared_ptr<Pool> keep; // 维持 into 所指池的生存期
+
+        Pool() : into(NULL), free(NULL), cursor(NULL), end(NULL), chunks(NULL), chunksTail(NULL), stats() {}
+        ~Pool() { while (chunks) { Chunk* c = chunks; chunks = c->next; std::free(c); } }
+
+        static size_t head() { return (sizeof(Chunk) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot); }
+
+        void grow() { // 新申请一块
+            long long n = stats.chunks ? stats.capacity : NODEPOOL_FIRST_CHUNK; // 与已有总量相当，即倍增
+            if (NODEPOOL_MAX_CHUNK < n) n = NODEPOOL_MAX_CHUNK;
+            size_t bytes = head() + sizeof(Slot) * (size_t) n;
+            Chunk* c = static_cast<Chunk*>(std::malloc(bytes));
+            if (!c) throw std::bad_alloc();
+            OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, bytes);
+            if (!chunks) chunksTail = c;
+            c->next = chunks; chunks = c;
+            cursor = reinterpret_cast<Slot*>(reinterpret_cast<char*>(c) + head());
+            end = cursor + n;
+            stats.chunks++; stats.capacity += n; stats.bytes += bytes;
+        }
+
+        void* take() {
+            Slot* s;
+            if (!free && cursor == end && !spare.empty()) { free = spare.back(); spare.pop_back(); }
+            if (free) { s = free; free = s->next; }
+            else { if (cursor == end) grow(); s = cursor++; }
+            if (stats.peak < ++stats.inUse) stats.peak = stats.inUse;
+            return s;
+        }
+
+        void give(void* p) {
+            Slot* s = static_cast<Slot*>(p);
+            s->next = free; free = s;
+            stats.inUse--;
+        }
+
+        void absorb(Pool& y) { // 将池 y 的全部空间并入本池，与两池的规模无关
+            spare.reserve(spare.size() + y.spare.size() + 1); // 可能抛出异常，须先于其余改动
+            spare.insert(spare.end(), y.spare.begin(), y.spare.end());
+            if (y.free) spare.push_back(y.free);
+            if (y.chunks) { y.chunksTail->next = chunks; if (!chunks) chunksTail = y.chunksTail; chunks = y.chunks; }
+            if (end - cursor < y.end - y.cursor) { std::swap(cursor, y.cursor); std::swap(end, y.end); } // 保留较长的未切分部分
+            while (y.cursor != y.end) { Slot* s = y.cursor++; s->next = free; free = s; } // 另一部分至多 NODEPOOL_MAX_CHUNK 个，挂入空闲链表
+            long long inUse = stats.inUse + y.stats.inUse;
+            stats.peak = std::max(std::max(stats.peak, y.stats.peak), inUse); // 各自的峰值与合并后的在用数，取其大者
+            stats.chunks += y.stats.chunks; stats.capacity += y.stats.capacity; stats.bytes += y.stats.bytes;
+            stats.inUse = inUse;
+            y.free = NULL; y.spare.clear(); y.chunks = NULL; y.cursor = y.end = NULL; y.stats = NodePoolStats();
+        }
+    };
+
+    mutable std::shared_ptr<Pool> _pool;
+
+    Pool* pool() const { // 实际的池：本池已并入其它池时，沿转发找到之，并令句柄直接指向之
+        Pool* p = _pool.get();
+        return p->into ? forward() : p;
+    }
+    Pool* forward() const { // 仅在句柄首次遇到已并入的池时执行
+        while (_pool->into) _pool = _pool->keep;
+        return _pool.get();
+    }
+
+public:
+    NodePool() : _pool(std::make_shared<Pool>()) {
+        static_assert(alignof(Node) <= alignof(std::max_align_t), "NodePool does not support over-aligned nodes");
+    }
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        Pool* pl = pool();
+        void* p = pl->take();
+        try { return new (p) Node(std::forward<Args>(args)...); }
+        catch (...) { pl->give(p); throw; }
+    }
+    void destroy(Node* p) { p->~Node(); pool()->give(p); }
+    void join(NodePool& b) { // 合并两池；此后本句柄、b 以及共享其中任一池的句柄均相等
+        Pool* x = pool(); Pool* y = b.pool();
+        if (x == y) return;
+        x->absorb(*y);
+        y->into = x; y->keep = _pool; b._pool = _pool;
+    }
+
+    NodePoolStats const& stats() const { return pool()->stats; }
+    bool operator==(NodePool const& b) const { return pool() == b.pool(); }
+    bool operator!=(NodePool const& b) const { return pool() != b.pool(); }
+};
+
+#endif // MYLIBRARY_NODEPOOL_H
@@ -0,0 +1,85 @@
+#ifndef MYLIBRARY_OPSTATS_H
+#define MYLIBRARY_OPSTATS_H
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+/* 基本操作计数：用于在计时器分辨不出差异时（如小规模输入）解释各算法的开销。
+   - 比较、复制、移动：以 Counted<T> 作为元素类型即可统计（类型策略，不用则无任何开销）
+   - 交换、堆分配次数与字节数：由容器内部统计，仅在定义 MYLIBRARY_STATS 时编译进来
+   计数器为全局变量，不做同步，不宜与多线程算法同时使用 */
+struct OpStats {
+    long long compares; // 比较次数
+    long long copies;   // 复制构造 / 复制赋值次数
+    long long moves;    // 移动构造 / 移动赋值次数（一次交换计三次移动）
+    long long swaps;    // 元素交换次数
+    long long allocs;   // 堆分配次数（含 realloc）
+    long long bytes;    // 累计申请字节数
+
+    static OpStats& get() { static OpStats s = { 0, 0, 0, 0, 0, 0 }; return s; }
+    static void reset() { get() = OpStats(); }
+
+    OpStats operator-(OpStats const& b) const {
+        OpStats d = { compares - b.compares, copies - b.copies, moves - b.moves,
+                      swaps - b.swaps, allocs - b.allocs, bytes - b.bytes };
+        return d;
+    }
+};
+
+#ifdef MYLIBRARY_STATS
+#define OPSTATS_ADD(field, n) (OpStats::get().field += (n))
+#else
+#define OPSTATS_ADD(field, n) ((void) 0)
+#endif
+
+/* 统计单次调用 f() 期间的操作增量 */
+template <typename F>
+OpStats measure(F f) {
+    OpStats before = OpStats::get();
+    f();
+    return OpStats::get() - before;
+}
+
+/* 元素交换：计数后交由 std::swap 完成 */
+template <typename T>
+inline void countedSwap(T& a, T& b) {
+    OPSTATS_ADD(swaps, 1);
+    std::swap(a, b);
+}
+
+/* 计数元素：包装 T，统计比较、复制与移动 */
+template <typename T>
+class Counted {
+private:
+    T _v;
+
+public:
+    Counted() : _v() {}
+    Counted(T const& v) : _v(v) {}
+    Counted(Counted const& c) : _v(c._v) { OpStats::get().copies++; }
+    Counted(Counted&& c) noexcept : _v(std::move(c._v)) { OpStats::get().moves++; }
+    Counted& operator=(Counted const& c) { _v = c._v; OpStats::get().copies++; return *this; }
+    Counted& operator=(Counted&& c) noexcept { _v = std::move(c._v); OpStats::get().moves++; return *this; }
+
+    T const& value() const { return _v; }
+
+    friend bool operator<(Counted const& a, Counted const& b) { OpStats::get().compares++; return a._v < b._v; }
+    friend bool operator>(Counted const& a, Counted const& b) { OpStats::get().compares++; return b._v < a._v; }
+    friend bool operator<=(Counted const& a, Counted const& b) { OpStats::get().compares++; return !(b._v < a._v); }
+    friend bool operator>=(Counted const& a, Counted const& b) { OpStats::get().compares++; return !(a._v < b._v); }
+    friend bool operator==(Counted const& a, Counted const& b) { OpStats::get().compares++; return a._v == b._v; }
+    friend bool operator!=(Counted const& a, Counted const& b) { OpStats::get().compares++; return !(a._v == b._v); }
+};
+
+/* 计数元素沿用 T 的散列（T 不可散列时，此特化亦不可调用） */
+namespace std {
+template <typename T>
+struct hash<Counted<T> > {
+    template <typename U = T>
+    auto operator()(Counted<U> const& c) const -> decltype(std::hash<U>()(c.value()))
+    { return std::hash<U>()(c.value()); }
+};
+}
+
+#endif // MYLIBRARY_OPSTATS_H
@@ -0,0 +1,59 @@
+#ifndef MYLIBRARY_PQ_COMPLHEAP_H
+#define MYLIBRARY_PQ_COMPLHEAP_H
+
+#include "Vector.h" // 借助向量，实现完全二叉堆
+#include <functional>
+
+/* 完全二叉堆的上滤：将 A[i] 沿父节点方向上移至合适位置，lt 为“小于”比较器 */
+template <typename T, typename Cmp>
+Rank percolateUp(T* A, Rank i, Cmp lt) {
+    T e = std::move(A[i]);
+    while (0 < i) {
+        Rank j = (i - 1) >> 1; // 父节点
+        if (!lt(A[j], e)) break;
+        A[i] = std::move(A[j]); i = j;
+    }
+    A[i] = std::move(e);
+    return i;
+}
+
+/* 基于向量的完全二叉堆优先级队列：堆顶为 lt 意义下的最大者；
+   以 std::greater<T> 为比较器即得小顶堆 */
+template <typename T, typename Cmp = std::less<T> >
+class PQ_ComplHeap : public Vector<T> {
+protected:
+    Cmp _lt; // 比较器
+
+public:
+    using Vector<T>::size;
+    using Vector<T>::empty;
+
+    PQ_ComplHeap(Cmp lt = Cmp()) : _lt(lt) {} // 默认构造
+    PQ_ComplHeap(T const* A, Rank n, Cmp lt = Cmp()) // 批量建堆，O(n)
+        : Vector<T>(A, 0, n), _lt(lt) { heapify(this->_elem, this->_size, _lt); }
+    PQ_ComplHeap(Vector<T>&& V, Cmp lt = Cmp()) // 接管向量后就地建堆，O(n)
+        : Vector<T>(std::move(V)), _lt(lt) { heapify(this->_elem, this->_size, _lt); }
+
+    void push(T const& e) { Vector<T>::insert(e); percolateUp(this->_elem, this->_size - 1, _lt); } // 插入
+    void push(T&& e) { Vector<T>::insert(std::move(e)); percolateUp(this->_elem, this->_size - 1, _lt); }
+    template <typename... Args>
+    void emplace(Args&&... args)
+    { Vector<T>::emplace_back(std::forward<Args>(args)...); percolateUp(this->_elem, this->_size - 1, _lt); }
+    T const& top() const { return this->_elem[0]; } // 取堆顶（assert: !empty()）
+    T pop(); // 删除并返回堆顶（assert: !empty()）
+    void replaceTop(T e) // 以 e 替换堆顶，只需一次下滤，代价低于 pop + push（assert: !empty()）
+    { this->_elem[0] = std::move(e); percolateDown(this->_elem, this->_size, 0, _lt); }
+};
+
+template <typename T, typename Cmp>
+T PQ_ComplHeap<T, Cmp>::pop() {
+    T maxElem = std::move(this->_elem[0]); // 摘除堆顶
+    T last = Vector<T>::remove(this->_size - 1); // 代之以末元素
+    if (!this->empty()) {
+        this->_elem[0] = std::move(last);
+        percolateDown(this->_elem, this->_size, 0, _lt); // 再对新堆顶下滤
+    }
+    return maxElem;
+}
+
+#endif // MYLIBRARY_PQ_COMPLHEAP_H
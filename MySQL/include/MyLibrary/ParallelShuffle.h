@@ -0,0 +1,106 @@
+#ifndef MYLIBRARY_PARALLELSHUFFLE_H
+#define MYLIBRARY_PARALLELSHUFFLE_H
+
+#include "Vector.h"
+#include "Random.h"
+#include <thread>
+
+#define SHUFFLE_BUCKETS 64               // 分桶数（亦为分片数）
+#define PARALLEL_SHUFFLE_MIN (1 << 16)   // 区间小于此规模时直接顺序置乱
+
+/* 并行随机置乱
+   1. 区间等分为 SHUFFLE_BUCKETS 片，各片独立地为每个元素随机指定一个桶，统计各片各桶的数目
+   2. 由计数的前缀和得出每片每桶的写入位置，各片将元素移入缓冲区中所属桶的位置
+   3. 各桶内部做 Fisher-Yates 置乱，再整体移回
+   各桶规模服从多项分布、桶内排列均匀，故整体排列均匀。
+   每片、每桶各用一条由 jump() 分出的子序列，与线程数及调度次序无关：
+   同一种子、同一区间长度总得到同一排列 */
+template <typename T>
+class ParallelShuffle {
+private:
+    T* _A;                  // 待置乱区间
+    T* _buf;                // 缓冲区
+    Rank _n;
+    unsigned char* _tag;    // 各元素所属桶
+    Rank (*_pos)[SHUFFLE_BUCKETS]; // 第 s 片：先为各桶计数，后为各桶的下一写入位置
+    Rank _start[SHUFFLE_BUCKETS + 1]; // 各桶在缓冲区中的起点
+    Xoshiro256 _rng[2 * SHUFFLE_BUCKETS]; // 前一半供分片，后一半供分桶
+
+    Rank sliceLo(int s) const { return Rank((long long) _n * s / SHUFFLE_BUCKETS); }
+
+    void classify(int s) {
+        for (Rank i = sliceLo(s); i < sliceLo(s + 1); ++i)
+            ++_pos[s][_tag[i] = (unsigned char) _rng[s].uniform(SHUFFLE_BUCKETS)];
+    }
+    void scatter(int s) {
+        for (Rank i = sliceLo(s); i < sliceLo(s + 1); ++i)
+            new (_buf + _pos[s][_tag[i]]++) T(std::move(_A[i]));
+    }
+    void shuffleBucket(int b) {
+        T* B = _buf + _start[b];
+        Xoshiro256& rng = _rng[SHUFFLE_BUCKETS + b];
+        for (Rank i = _start[b + 1] - _start[b]; i > 0; --i)
+            countedSwap(B[i - 1], B[rng.uniform(i)]);
+    }
+    void gather(int s) {
+        for (Rank i = sliceLo(s); i < sliceLo(s + 1); ++i) { _A[i] = std::move(_buf[i]); _buf[i].~T(); }
+    }
+
+    /* 以 threads 个线程完成 (this->*task)(0 .. SHUFFLE_BUCKETS - 1) */
+    void run(void (ParallelShuffle::*task)(int), int threads) {
+        std::thread* workers = new std::thread[threads - 1];
+        for (int t = 0; t < threads - 1; ++t)
+            workers[t] = std::thread([=] { for (int k = t; k < SHUFFLE_BUCKETS; k += threads) (this->*task)(k); });
+        for (int k = threads - 1; k < SHUFFLE_BUCKETS; k += threads) (this->*task)(k); // 当前线程亦承担一份
+        for (int t = 0; t < threads - 1; ++t) workers[t].join();
+        delete[] workers;
+    }
+
+public:
+    ParallelShuffle(uint64_t seed) {
+        _rng[0].seed(seed);
+        for (int k = 1; k < 2 * SHUFFLE_BUCKETS; ++k) { _rng[k] = _rng[k - 1]; _rng[k].jump(); }
+    }
+
+    void operator()(T* A, Rank n, int threads) { // 置乱 A[0, n)
+        if (n < 2) return;
+        if (n < PARALLEL_SHUFFLE_MIN) { // 规模较小，顺序置乱
+            for (Rank i = n; i > 0; --i) countedSwap(A[i - 1], A[_rng[0].uniform(i)]);
+            return;
+        }
+        if (threads < 1) threads = 1;
+        if (SHUFFLE_BUCKETS < threads) threads = SHUFFLE_BUCKETS;
+        _A = A; _n = n;
+        _buf = static_cast<T*>(std::malloc(sizeof(T) * n));
+        if (!_buf) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(T) * n);
+        _tag = new unsigned char[n];
+        _pos = new Rank[SHUFFLE_BUCKETS][SHUFFLE_BUCKETS]();
+        run(&ParallelShuffle::classify, threads);
+        Rank sum = 0; // 按桶优先、片次之的次序累计前缀和
+        for (int b = 0; b < SHUFFLE_BUCKETS; ++b) {
+            _start[b] = sum;
+            for (int s = 0; s < SHUFFLE_BUCKETS; ++s) { Rank c = _pos[s][b]; _pos[s][b] = sum; sum += c; }
+        }
+        _start[SHUFFLE_BUCKETS] = sum;
+        run(&ParallelShuffle::scatter, threads);
+        run(&ParallelShuffle::shuffleBucket, threads);
+        run(&ParallelShuffle::gather, threads);
+        delete[] _pos;
+        delete[] _tag;
+        std::free(_buf);
+    }
+};
+
+/* 以种子 seed 并行置乱向量区间 [lo, hi)；threads 为 0 时取硬件线程数 */
+template <typename T>
+void parallelShuffle(Vector<T>& V, Rank lo, Rank hi, uint64_t seed, int threads = 0) {
+    if (threads <= 0) threads = (int) std::thread::hardware_concurrency();
+    ParallelShuffle<T> shuffler(seed);
+    shuffler(V.data() + lo, hi - lo, threads);
+}
+
+template <typename T>
+void parallelShuffle(Vector<T>& V, uint64_t seed, int threads = 0) { parallelShuffle(V, 0, V.size(), seed, threads); }
+
+#endif // MYLIBRARY_PARALLELSHUFFLE_H
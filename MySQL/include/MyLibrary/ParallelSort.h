@@ -0,0 +1,126 @@
+#ifndef MYLIBRARY_PARALLELSORT_H
+#define MYLIBRARY_PARALLELSORT_H
+
+#include "Vector.h"
+#include <thread>
+#include <functional>
+
+#define PARALLEL_SORT_CUTOFF 32          // 叶区间改用插入排序的规模
+#define PARALLEL_TASK_MIN (1 << 14)      // 区间不小于此规模时才拆分为新线程
+#define PARALLEL_MERGE_MIN (1 << 16)     // 区间不小于此规模时才并行归并
+
+/* 并行稳定归并排序
+   - 整趟排序只申请一块与区间等长的缓冲区：先将数据整体移入缓冲区，此后在原数组与缓冲区
+     之间交替归并（ping-pong），叶区间直接从缓冲区插入排序至目标数组，全程只移动不复制
+   - 递归时将左半区间交给新线程，线程预算逐层对半分配
+   - 大区间的归并按输出位置均分，借助协同秩（co-rank）二分查找各段在两个输入中的起点，
+     各段互不重叠，可由多个线程同时完成
+   - 相等元素总是左侧优先，故排序稳定 */
+template <typename T, typename Cmp = std::less<T> >
+class ParallelMergeSort {
+private:
+    Cmp _lt;
+    T* _orig; // 数据的原始所在（缓冲区），叶区间由此读取
+
+public:
+    ParallelMergeSort(Cmp lt = Cmp()) : _lt(lt), _orig(NULL) {}
+
+    void operator()(T* A, Rank n, int threads) { // 对 A[0, n) 排序
+        if (n < 2) return;
+        if (threads < 1) threads = 1;
+        T* B = static_cast<T*>(std::malloc(sizeof(T) * n));
+        if (!B) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(T) * n);
+        for (Rank i = 0; i < n; ++i) new (B + i) T(std::move(A[i]));
+        _orig = B;
+        sort(A, B, 0, n, threads);
+        for (Rank i = 0; i < n; ++i) B[i].~T();
+        std::free(B);
+    }
+
+private:
+    /* 将 [lo, hi) 排序后写入 dst；tmp 为另一数组，供子区间存放结果 */
+    void sort(T* dst, T* tmp, Rank lo, Rank hi, int threads) {
+        if (hi - lo <= PARALLEL_SORT_CUTOFF) { leaf(dst, lo, hi); return; }
+        Rank mi = lo + ((hi - lo) >> 1);
+        if (1 < threads && PARALLEL_TASK_MIN <= hi - lo) {
+            int half = threads >> 1;
+            std::thread left(&ParallelMergeSort::sort, this, tmp, dst, lo, mi, half);
+            sort(tmp, dst, mi, hi, threads - half);
+            left.join();
+        } else {
+            sort(tmp, dst, lo, mi, 1);
+            sort(tmp, dst, mi, hi, 1);
+        }
+        if (1 < threads && PARALLEL_MERGE_MIN <= hi - lo) parallelMerge(tmp, lo, mi, hi, dst, threads);
+        else merge(tmp + lo, mi - lo, tmp + mi, hi - mi, dst + lo);
+    }
+
+    /* 叶区间：从原始数据插入排序至 dst（若 dst 即原始数据所在，则就地排序） */
+    void leaf(T* dst, Rank lo, Rank hi) {
+        T* src = _orig;
+        for (Rank i = lo; i < hi; ++i) {
+            T e = std::move(src[i]);
+            Rank j = i;
+            for (; lo < j && _lt(e, dst[j - 1]); --j) dst[j] = std::move(dst[j - 1]);
+            dst[j] = std::move(e);
+        }
+    }
+
+    /* 顺序归并 L[0, lb) 与 R[0, lc) 至 out */
+    void merge(T* L, Rank lb, T* R, Rank lc, T* out) {
+        Rank j = 0, k = 0;
+        while (j < lb && k < lc)
+            *out++ = _lt(R[k], L[j]) ? std::move(R[k++]) : std::move(L[j++]);
+        while (j < lb) *out++ = std::move(L[j++]);
+        while (k < lc) *out++ = std::move(R[k++]);
+    }
+
+    /* 协同秩：归并输出的前 d 个元素中，来自 L 的个数 i（其余 d - i 个来自 R） */
+    Rank coRank(Rank d, T* L, Rank lb, T* R, Rank lc) {
+        Rank lo = (d > lc) ? d - lc : 0, hi = (d < lb) ? d : lb;
+        while (true) {
+            Rank i = lo + ((hi - lo) >> 1), j = d - i;
+            if (0 < i && j < lc && _lt(R[j], L[i - 1])) hi = i - 1;       // 取 L 过多
+            else if (0 < j && i < lb && !_lt(R[j - 1], L[i])) lo = i + 1; // 取 L 过少
+            else return i;
+        }
+    }
+
+    /* 并行归并 src[lo, mi) 与 src[mi, hi) 至 dst[lo, hi)：按输出位置均分为 threads 段。
+       归并会移走输入元素，故须在启动任何线程之前求出全部分段点 */
+    void parallelMerge(T* src, Rank lo, Rank mi, Rank hi, T* dst, int threads) {
+        T* L = src + lo; Rank lb = mi - lo;
+        T* R = src + mi; Rank lc = hi - mi;
+        Rank n = hi - lo;
+        Rank* d = new Rank[threads + 1]; // 各段输出起点
+        Rank* i = new Rank[threads + 1]; // 各段在 L 中的起点（在 R 中的起点即 d - i）
+        for (int t = 0; t <= threads; ++t) {
+            d[t] = Rank((long long) n * t / threads);
+            i[t] = coRank(d[t], L, lb, R, lc);
+        }
+        std::thread* workers = new std::thread[threads - 1];
+        for (int t = 0; t < threads - 1; ++t)
+            workers[t] = std::thread(&ParallelMergeSort::merge, this, L + i[t], i[t + 1] - i[t],
+                                     R + (d[t] - i[t]), (d[t + 1] - i[t + 1]) - (d[t] - i[t]), dst + lo + d[t]);
+        int t = threads - 1; // 末段由当前线程完成
+        merge(L + i[t], i[t + 1] - i[t], R + (d[t] - i[t]), (d[t + 1] - i[t + 1]) - (d[t] - i[t]), dst + lo + d[t]);
+        for (int k = 0; k < threads - 1; ++k) workers[k].join();
+        delete[] workers; delete[] d; delete[] i;
+    }
+};
+
+/* 对向量区间 [lo, hi) 做并行稳定归并排序；threads 为 0 时取硬件线程数 */
+template <typename T, typename Cmp>
+void parallelMergeSort(Vector<T>& V, Rank lo, Rank hi, int threads, Cmp lt) {
+    if (threads <= 0) threads = (int) std::thread::hardware_concurrency();
+    ParallelMergeSort<T, Cmp> sorter(lt);
+    sorter(V.data() + lo, hi - lo, threads);
+}
+
+template <typename T>
+void parallelMergeSort(Vector<T>& V, Rank lo, Rank hi, int threads = 0) {
+    parallelMergeSort(V, lo, hi, threads, std::less<T>());
+}
+
+#endif // MYLIBRARY_PARALLELSORT_H
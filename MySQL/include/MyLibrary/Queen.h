@@ -3,39 +3,82 @@
 
 #include "../../Vector.h"
 
+#define QUEUE_DEFAULT_CAPACITY 16 // 缺省初始容量（须为 2 的幂）
+
+/* 队列：循环数组实现
+   - 元素依次存放于 _elem[(_head + i) & (_capacity - 1)]，i = 0, 1, ..., _size - 1
+   - 容量恒为 2 的幂，故回绕只需按位与；队满时容量加倍，分摊 O(1)
+   - 出队只移动队首下标，不搬迁其余元素 */
 template <typename T>
 class Queue {
 private:
-    Vector<T> data;
-    
+    T* _elem; int _capacity; int _head; int _size; // 存储区、容量、队首下标、规模
+
+    T& at(int i) const { return _elem[(_head + i) & (_capacity - 1)]; } // 队中第 i 个元素
+
+    void reallocate(int c) { // 容量调整为 c（2 的幂，不小于规模），元素按队中次序移至 [0, _size)
+        size_t bytes = sizeof(T) * (size_t) c;
+        T* elem = static_cast<T*>(std::malloc(bytes));
+        if (!elem) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, bytes);
+        for (int i = 0; i < _size; i++) { new (elem + i) T(std::move(at(i))); at(i).~T(); }
+        std::free(_elem);
+        _elem = elem; _capacity = c; _head = 0;
+    }
+
 public:
-    Queue() {}
-    
+    Queue(int c = QUEUE_DEFAULT_CAPACITY) : _elem(NULL), _capacity(0), _head(0), _size(0) {
+        int cap = 1;
+        while (cap < c) cap <<= 1; // 上调至 2 的幂
+        reallocate(cap);
+    }
+    Queue(Queue const& Q) : _elem(NULL), _capacity(0), _head(0), _size(0) {
+        if (Q._capacity) reallocate(Q._capacity); // 被移走的队列容量为 0，副本同样留待首次入队时申请
+        for (int i = 0; i < Q._size; i++) enqueue(Q.at(i));
+    }
+    Queue(Queue&& Q) : _elem(Q._elem), _capacity(Q._capacity), _head(Q._head), _size(Q._size)
+    { Q._elem = NULL; Q._capacity = Q._head = Q._size = 0; }
+    ~Queue() { clear(); std::free(_elem); }
+    Queue& operator=(Queue Q) { // 复制并交换
+        std::swap(_elem, Q._elem); std::swap(_capacity, Q._capacity);
+        std::swap(_head, Q._head); std::swap(_size, Q._size);
+        return *this;
+    }
+
     void enqueue(const T& e) {
-        data.insert(e);
+        if (_size == _capacity) reallocate(_capacity ? _capacity << 1 : 1);
+        new (&at(_size)) T(e); _size++;
+    }
+    void enqueue(T&& e) {
+        if (_size == _capacity) reallocate(_capacity ? _capacity << 1 : 1);
+        new (&at(_size)) T(std::move(e)); _size++;
     }
-    
+
     T dequeue() {
         if (empty()) {
             throw "Queue is empty";
         }
-        return data.remove(0);
+        T e = std::move(at(0)); at(0).~T();
+        _head = (_head + 1) & (_capacity - 1); _size--;
+        return e;
     }
-    
+
     T& front() {
         if (empty()) {
             throw "Queue is empty";
         }
-        return data[0];
+        return at(0);
     }
-    
+
+    void clear() { while (_size) { at(0).~T(); _head = (_head + 1) & (_capacity - 1); _size--; } }
+
     bool empty() const {
-        return data.empty();
+        return !_size;
     }
-    
+
     int size() const {
-        return data.size();
+        return _size;
     }
 };
 
-#endif
\ No newline at end of file
+#endif
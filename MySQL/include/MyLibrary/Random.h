@@ -0,0 +1,82 @@
+#ifndef MYLIBRARY_RANDOM_H
+#define MYLIBRARY_RANDOM_H
+
+#include <cstdint>
+#include <atomic>
+
+typedef int Rank;
+
+/* xoshiro256** 伪随机数发生器：周期 2^256 - 1，64 位输出，每次只需几次移位与乘法
+   - 以 splitmix64 由 64 位种子展开内部状态，相同种子总得到相同序列
+   - jump() 前进 2^128 步，可为各线程划分互不重叠的子序列 */
+class Xoshiro256 {
+private:
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+    static uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+public:
+    typedef uint64_t result_type; // 可直接用于 <random> 中的分布
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~(result_type) 0; }
+
+    explicit Xoshiro256(uint64_t seed = 0) { this->seed(seed); }
+
+    void seed(uint64_t seed) { for (int i = 0; i < 4; ++i) s[i] = splitmix64(seed); }
+
+    uint64_t next() {
+        uint64_t result = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0]; s[3] ^= s[1]; s[1] ^= s[2]; s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+    result_type operator()() { return next(); }
+
+    /* [0, n) 内均匀分布的整数（n > 0）：乘法取高位，拒绝少量样本以消除偏差（Lemire） */
+    Rank uniform(Rank n) {
+        uint64_t m = (next() >> 32) * (uint64_t) n;
+        uint32_t l = (uint32_t) m;
+        if (l < (uint32_t) n) {
+            uint32_t t = (uint32_t) (-(uint32_t) n) % (uint32_t) n;
+            while (l < t) { m = (next() >> 32) * (uint64_t) n; l = (uint32_t) m; }
+        }
+        return (Rank) (m >> 32);
+    }
+
+    /* [0, 1) 内均匀分布的实数（53 位精度） */
+    double nextDouble() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    /* 前进 2^128 步 */
+    void jump() {
+        static const uint64_t J[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                      0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+        uint64_t t[4] = { 0, 0, 0, 0 };
+        for (int i = 0; i < 4; ++i)
+            for (int b = 0; b < 64; ++b) {
+                if (J[i] & ((uint64_t) 1 << b)) { t[0] ^= s[0]; t[1] ^= s[1]; t[2] ^= s[2]; t[3] ^= s[3]; }
+                next();
+            }
+        for (int i = 0; i < 4; ++i) s[i] = t[i];
+    }
+};
+
+/* 线程局部的默认发生器：各线程首次使用时按启用次序取得不同的固定种子，
+   故单线程程序不调用 seedRandom 时每次运行结果亦相同；无需加锁，互不干扰 */
+inline Xoshiro256& threadRng() {
+    static std::atomic<uint64_t> streams(0);
+    static thread_local Xoshiro256 rng(0x853C49E6748FEA9BULL + streams++ * 0x9E3779B97F4A7C15ULL);
+    return rng;
+}
+
+/* 为当前线程的默认发生器重新播种 */
+inline void seedRandom(uint64_t seed) { threadRng().seed(seed); }
+
+#endif // MYLIBRARY_RANDOM_H
@@ -0,0 +1,288 @@
+#ifndef MYLIBRARY_SIMDSCAN_H
+#define MYLIBRARY_SIMDSCAN_H
+
+#include <type_traits>
+
+typedef int Rank;
+
+/* 顺序扫描算法：查找、相邻逆序对计数与最小/最大/求和归约
+   - 通用版本逐个元素处理；int、float、double 另有 SIMD 版本，运行时检测 CPU：
+     支持 AVX2 时每次处理 256 位，否则以 x86-64 必备的 SSE2 每次处理 128 位
+   - 仅在 GCC/Clang 的 x86 目标上启用 SIMD；定义 MYLIBRARY_NO_SIMD 可强制逐个处理
+   - 浮点数含 NaN 时，min/max 的结果不确定 */
+
+/* 和的类型：整数以 64 位累加，float 以 double 累加 */
+template <typename T>
+struct SumOf {
+    typedef typename std::conditional<std::is_integral<T>::value,
+        typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type,
+        typename std::conditional<std::is_same<T, float>::value, double, T>::type>::type type;
+};
+
+/* 无序查找：返回 [lo, hi) 中最后一个等于 e 的元素的秩；失败返回 lo - 1 */
+template <typename T>
+Rank scanFind(T const* A, T const& e, Rank lo, Rank hi) {
+    while ((lo < hi--) && !(e == A[hi])) ;
+    return hi;
+}
+
+/* 相邻逆序对数：满足 A[i] < A[i - 1] 的 i 的数目 */
+template <typename T>
+int scanDisordered(T const* A, Rank n) {
+    int c = 0;
+    for (Rank i = 1; i < n; ++i)
+        if (A[i] < A[i - 1]) ++c;
+    return c;
+}
+
+/* 最小、最大元素（n > 0） */
+template <typename T>
+T scanMin(T const* A, Rank n) {
+    T m = A[0];
+    for (Rank i = 1; i < n; ++i) if (A[i] < m) m = A[i];
+    return m;
+}
+
+template <typename T>
+T scanMax(T const* A, Rank n) {
+    T m = A[0];
+    for (Rank i = 1; i < n; ++i) if (m < A[i]) m = A[i];
+    return m;
+}
+
+template <typename T>
+typename SumOf<T>::type scanSum(T const* A, Rank n) {
+    typename SumOf<T>::type s = typename SumOf<T>::type();
+    for (Rank i = 0; i < n; ++i) s += A[i];
+    return s;
+}
+
+#if !defined(MYLIBRARY_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define MYLIBRARY_SIMD_X86
+#include <immintrin.h>
+
+#define SIMD_AVX2_TARGET __attribute__((target("avx2,popcnt"))) // 支持 AVX2 的处理器均支持 POPCNT
+
+typedef enum { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 } SimdLevel;
+
+inline SimdLevel simdDetect() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? SIMD_AVX2 : SIMD_SSE2;
+}
+
+inline SimdLevel& simdLevelRef() { static SimdLevel level = simdDetect(); return level; }
+
+/* 当前采用的指令集；setSimdLevel 可将其降低（便于对比测试），但不会超出 CPU 所支持者 */
+inline SimdLevel simdLevel() { return simdLevelRef(); }
+inline void setSimdLevel(SimdLevel level) {
+    SimdLevel best = simdDetect();
+    simdLevelRef() = (level < best) ? level : best;
+}
+
+/* 各指令集下各元素类型的基本操作：
+   W 为每个向量的元素数；eqMask/ltMask 将逐元素比较结果压缩为位掩码，count 统计其中 1 的个数；
+   Acc 为求和的累加器，add 将一个向量的各元素（按需加宽）计入其中 */
+template <typename T> struct Sse2Ops;
+
+template <> struct Sse2Ops<int> {
+    typedef __m128i V; typedef __m128i Acc; enum { W = 4 };
+    static V load(int const* p) { return _mm_loadu_si128((__m128i const*) p); }
+    static V set1(int x) { return _mm_set1_epi32(x); }
+    static int eqMask(V a, V b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    static int ltMask(V a, V b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(a, b))); }
+    static int count(int m) { return (0x4332322132212110LL >> (m << 2)) & 0xF; } // 至多 4 位，查半字节表
+    static V min(V a, V b) { V m = _mm_cmplt_epi32(a, b); return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    static V max(V a, V b) { V m = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    static void store(int* p, V v) { _mm_storeu_si128((__m128i*) p, v); }
+    static Acc zero() { return _mm_setzero_si128(); }
+    static Acc add(Acc s, V v) { // 符号扩展为两组 64 位整数
+        V sign = _mm_srai_epi32(v, 31);
+        return _mm_add_epi64(_mm_add_epi64(s, _mm_unpacklo_epi32(v, sign)), _mm_unpackhi_epi32(v, sign));
+    }
+    static long long reduce(Acc s) { long long t[2]; _mm_storeu_si128((__m128i*) t, s); return t[0] + t[1]; }
+};
+
+template <> struct Sse2Ops<float> {
+    typedef __m128 V; typedef __m128d Acc; enum { W = 4 };
+    static V load(float const* p) { return _mm_loadu_ps(p); }
+    static V set1(float x) { return _mm_set1_ps(x); }
+    static int eqMask(V a, V b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static int ltMask(V a, V b) { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+    static int count(int m) { return (0x4332322132212110LL >> (m << 2)) & 0xF; }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+    static Acc zero() { return _mm_setzero_pd(); }
+    static Acc add(Acc s, V v) { return _mm_add_pd(_mm_add_pd(s, _mm_cvtps_pd(v)), _mm_cvtps_pd(_mm_movehl_ps(v, v))); }
+    static double reduce(Acc s) { double t[2]; _mm_storeu_pd(t, s); return t[0] + t[1]; }
+};
+
+template <> struct Sse2Ops<double> {
+    typedef __m128d V; typedef __m128d Acc; enum { W = 2 };
+    static V load(double const* p) { return _mm_loadu_pd(p); }
+    static V set1(double x) { return _mm_set1_pd(x); }
+    static int eqMask(V a, V b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    static int ltMask(V a, V b) { return _mm_movemask_pd(_mm_cmplt_pd(a, b)); }
+    static int count(int m) { return (0x4332322132212110LL >> (m << 2)) & 0xF; }
+    static V min(V a, V b) { return _mm_min_pd(a, b); }
+    static V max(V a, V b) { return _mm_max_pd(a, b); }
+    static void store(double* p, V v) { _mm_storeu_pd(p, v); }
+    static Acc zero() { return _mm_setzero_pd(); }
+    static Acc add(Acc s, V v) { return _mm_add_pd(s, v); }
+    static double reduce(Acc s) { double t[2]; _mm_storeu_pd(t, s); return t[0] + t[1]; }
+};
+
+template <typename T> struct Avx2Ops;
+
+template <> struct Avx2Ops<int> {
+    typedef __m256i V; typedef __m256i Acc; enum { W = 8 };
+    SIMD_AVX2_TARGET static V load(int const* p) { return _mm256_loadu_si256((__m256i const*) p); }
+    SIMD_AVX2_TARGET static V set1(int x) { return _mm256_set1_epi32(x); }
+    SIMD_AVX2_TARGET static int eqMask(V a, V b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+    SIMD_AVX2_TARGET static int ltMask(V a, V b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a))); }
+    SIMD_AVX2_TARGET static int count(int m) { return _mm_popcnt_u32(m); }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_max_epi32(a, b); }
+    SIMD_AVX2_TARGET static void store(int* p, V v) { _mm256_storeu_si256((__m256i*) p, v); }
+    SIMD_AVX2_TARGET static Acc zero() { return _mm256_setzero_si256(); }
+    SIMD_AVX2_TARGET static Acc add(Acc s, V v) {
+        return _mm256_add_epi64(_mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v))),
+                                _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    SIMD_AVX2_TARGET static long long reduce(Acc s) {
+        long long t[4]; _mm256_storeu_si256((__m256i*) t, s); return t[0] + t[1] + t[2] + t[3];
+    }
+};
+
+template <> struct Avx2Ops<float> {
+    typedef __m256 V; typedef __m256d Acc; enum { W = 8 };
+    SIMD_AVX2_TARGET static V load(float const* p) { return _mm256_loadu_ps(p); }
+    SIMD_AVX2_TARGET static V set1(float x) { return _mm256_set1_ps(x); }
+    SIMD_AVX2_TARGET static int eqMask(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    SIMD_AVX2_TARGET static int ltMask(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+    SIMD_AVX2_TARGET static int count(int m) { return _mm_popcnt_u32(m); }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    SIMD_AVX2_TARGET static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    SIMD_AVX2_TARGET static Acc zero() { return _mm256_setzero_pd(); }
+    SIMD_AVX2_TARGET static Acc add(Acc s, V v) {
+        return _mm256_add_pd(_mm256_add_pd(s, _mm256_cvtps_pd(_mm256_castps256_ps128(v))),
+                             _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+    SIMD_AVX2_TARGET static double reduce(Acc s) {
+        double t[4]; _mm256_storeu_pd(t, s); return (t[0] + t[1]) + (t[2] + t[3]);
+    }
+};
+
+template <> struct Avx2Ops<double> {
+    typedef __m256d V; typedef __m256d Acc; enum { W = 4 };
+    SIMD_AVX2_TARGET static V load(double const* p) { return _mm256_loadu_pd(p); }
+    SIMD_AVX2_TARGET static V set1(double x) { return _mm256_set1_pd(x); }
+    SIMD_AVX2_TARGET static int eqMask(V a, V b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+    SIMD_AVX2_TARGET static int ltMask(V a, V b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+    SIMD_AVX2_TARGET static int count(int m) { return _mm_popcnt_u32(m); }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_min_pd(a, b); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_max_pd(a, b); }
+    SIMD_AVX2_TARGET static void store(double* p, V v) { _mm256_storeu_pd(p, v); }
+    SIMD_AVX2_TARGET static Acc zero() { return _mm256_setzero_pd(); }
+    SIMD_AVX2_TARGET static Acc add(Acc s, V v) { return _mm256_add_pd(s, v); }
+    SIMD_AVX2_TARGET static double reduce(Acc s) {
+        double t[4]; _mm256_storeu_pd(t, s); return (t[0] + t[1]) + (t[2] + t[3]);
+    }
+};
+
+/* 各算法的向量化实现。两组函数体相同，只因 AVX2 版本须整体以 avx2 为目标编译方能内联上述操作，
+   故分别定义；Ops 为 Sse2Ops<T> 或 Avx2Ops<T> */
+#define SIMD_SCAN_KERNELS(PREFIX, ATTR)                                                     \
+template <typename Ops, typename T>                                                         \
+ATTR Rank PREFIX##Find(T const* A, T const& e, Rank lo, Rank hi) { /* 自后向前，逐块比对 */ \
+    typename Ops::V v = Ops::set1(e);                                                       \
+    for (; Ops::W <= hi - lo; hi -= Ops::W) {                                               \
+        int m = Ops::eqMask(Ops::load(A + hi - Ops::W), v);                                 \
+        if (m) return hi - Ops::W + (31 - __builtin_clz(m)); /* 块内最后一个命中者 */       \
+    }                                                                                       \
+    return scanFind<T>(A, e, lo, hi);                                                       \
+}                                                                                           \
+template <typename Ops, typename T>                                                         \
+ATTR int PREFIX##Disordered(T const* A, Rank n) { /* A[i, i + W) 与 A[i - 1, i - 1 + W) 逐一比较 */ \
+    int c = 0;                                                                              \
+    Rank i = 1;                                                                             \
+    for (; i + Ops::W <= n; i += Ops::W)                                                    \
+        c += Ops::count(Ops::ltMask(Ops::load(A + i), Ops::load(A + i - 1)));               \
+    for (; i < n; ++i) if (A[i] < A[i - 1]) ++c;                                            \
+    return c;                                                                               \
+}                                                                                           \
+template <typename Ops, typename T, bool Max>                                               \
+ATTR T PREFIX##Extreme(T const* A, Rank n) {                                                \
+    if (n < Ops::W) return Max ? scanMax<T>(A, n) : scanMin<T>(A, n);                       \
+    typename Ops::V m = Ops::load(A);                                                       \
+    Rank i = Ops::W;                                                                        \
+    for (; i + Ops::W <= n; i += Ops::W)                                                    \
+        m = Max ? Ops::max(m, Ops::load(A + i)) : Ops::min(m, Ops::load(A + i));            \
+    T lane[Ops::W];                                                                         \
+    Ops::store(lane, m);                                                                    \
+    T r = Max ? scanMax<T>(lane, Ops::W) : scanMin<T>(lane, Ops::W);                        \
+    for (; i < n; ++i) if (Max ? (r < A[i]) : (A[i] < r)) r = A[i];                         \
+    return r;                                                                               \
+}                                                                                           \
+template <typename Ops, typename T>                                                         \
+ATTR typename SumOf<T>::type PREFIX##Sum(T const* A, Rank n) {                              \
+    typename Ops::Acc s = Ops::zero();                                                      \
+    Rank i = 0;                                                                             \
+    for (; i + Ops::W <= n; i += Ops::W) s = Ops::add(s, Ops::load(A + i));                 \
+    typename SumOf<T>::type r = Ops::reduce(s);                                             \
+    for (; i < n; ++i) r += A[i];                                                           \
+    return r;                                                                               \
+}
+
+SIMD_SCAN_KERNELS(sse2, )
+SIMD_SCAN_KERNELS(avx2, SIMD_AVX2_TARGET)
+#undef SIMD_SCAN_KERNELS
+
+/* int、float、double 的重载：按 simdLevel() 分派（浮点求和的结合次序与逐个累加不同，末位可能有出入） */
+#define SIMD_SCAN_DISPATCH(T)                                                               \
+inline Rank scanFind(T const* A, T const& e, Rank lo, Rank hi) {                            \
+    switch (simdLevel()) {                                                                  \
+        case SIMD_AVX2: return avx2Find<Avx2Ops<T> >(A, e, lo, hi);                         \
+        case SIMD_SSE2: return sse2Find<Sse2Ops<T> >(A, e, lo, hi);                         \
+        default: return scanFind<T>(A, e, lo, hi);                                          \
+    }                                                                                       \
+}                                                                                           \
+inline int scanDisordered(T const* A, Rank n) {                                             \
+    switch (simdLevel()) {                                                                  \
+        case SIMD_AVX2: return avx2Disordered<Avx2Ops<T> >(A, n);                           \
+        case SIMD_SSE2: return sse2Disordered<Sse2Ops<T> >(A, n);                           \
+        default: return scanDisordered<T>(A, n);                                            \
+    }                                                                                       \
+}                                                                                           \
+inline T scanMin(T const* A, Rank n) {                                                      \
+    switch (simdLevel()) {                                                                  \
+        case SIMD_AVX2: return avx2Extreme<Avx2Ops<T>, T, false>(A, n);                     \
+        case SIMD_SSE2: return sse2Extreme<Sse2Ops<T>, T, false>(A, n);                     \
+        default: return scanMin<T>(A, n);                                                   \
+    }                                                                                       \
+}                                                                                           \
+inline T scanMax(T const* A, Rank n) {                                                      \
+    switch (simdLevel()) {                                                                  \
+        case SIMD_AVX2: return avx2Extreme<Avx2Ops<T>, T, true>(A, n);                      \
+        case SIMD_SSE2: return sse2Extreme<Sse2Ops<T>, T, true>(A, n);                      \
+        default: return scanMax<T>(A, n);                                                   \
+    }                                                                                       \
+}                                                                                           \
+inline SumOf<T>::type scanSum(T const* A, Rank n) {                                         \
+    switch (simdLevel()) {                                                                  \
+        case SIMD_AVX2: return avx2Sum<Avx2Ops<T> >(A, n);                                  \
+        case SIMD_SSE2: return sse2Sum<Sse2Ops<T> >(A, n);                                  \
+        default: return scanSum<T>(A, n);                                                   \
+    }                                                                                       \
+}
+
+SIMD_SCAN_DISPATCH(int)
+SIMD_SCAN_DISPATCH(float)
+SIMD_SCAN_DISPATCH(double)
+#undef SIMD_SCAN_DISPATCH
+
+#endif // SIMD x86
+
+#endif // MYLIBRARY_SIMDSCAN_H
@@ -1,18 +1,21 @@
 #ifndef SKIPLIST_H
 #define SKIPLIST_H
 
-#include <cstdlib>      // rand
 #include <cstring>      // strlen/strcpy
-#include "Vector.h"     // 复用你已有的 Vector 模板
+#include <cstdio>       // printf
+#include "Random.h"     // 线程局部发生器，层数可由种子复现
+#include "SmallVector.h" // 各层指针与查找路径均就地存放，免去额外的堆分配
 
 template <typename K, typename V>
 class Skiplist {
 private:
+    static constexpr int NODE_INLINE = 4;   // 节点内就地存放的层数
+
     /* ---------- 内部节点 ---------- */
     struct Node {
         K key;
         V val;
-        Vector<Node*> next;   // 多层前向指针
+        SmallVector<Node*, NODE_INLINE> next; // 多层前向指针（P = 0.5 时约 94% 的节点不超过 4 层）
         Node(const K& k, const V& v, int lvl)
             : key(k), val(v), next(lvl, nullptr) {}
     };
@@ -28,7 +31,7 @@ private:
     /* 随机生成层数 [1, MAX_LEVEL] */
     int randomLevel() {
         int lvl = 1;
-        while ((rand() / double(RAND_MAX)) < P && lvl < MAX_LEVEL) ++lvl;
+        while (threadRng().nextDouble() < P && lvl < MAX_LEVEL) ++lvl;
         return lvl;
     }
 
@@ -52,7 +55,7 @@ public:
 
     /* 插入：若 key 已存在则覆盖 val */
     void insert(const K& key, const V& val) {
-        Vector<NodePtr> prev(MAX_LEVEL, header);
+        SmallVector<NodePtr, MAX_LEVEL> prev(MAX_LEVEL, header); // 全部就地存放
         NodePtr p = header;
 
         /* 1. 逐层搜索前驱 */
@@ -97,7 +100,7 @@ public:
 
     /* 删除：成功返回 true，失败 false */
     bool remove(const K& key) {
-        Vector<NodePtr> prev(MAX_LEVEL, header);
+        SmallVector<NodePtr, MAX_LEVEL> prev(MAX_LEVEL, header);
         NodePtr p = header;
 
         for (int i = level - 1; i >= 0; --i) {
@@ -0,0 +1,123 @@
+#ifndef MYLIBRARY_SMALLVECTOR_H
+#define MYLIBRARY_SMALLVECTOR_H
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "OpStats.h"
+
+typedef int Rank;
+
+/* 小向量：至多 N 个元素就地存放于对象内部，超出时才转入堆空间
+   - 接口与 Vector 一致（循秩访问、插入、删除、查找、遍历），适用于规模通常很小、
+     生命周期短或大量存在的容器，如跳表节点的各层指针、查找路径上的前驱
+   - 只有 [0, _size) 已构造；转入堆空间后不再回到内部存储 */
+template <typename T, int N>
+class SmallVector {
+private:
+    Rank _size;     // 当前规模
+    int _capacity;  // 当前容量（不小于 N）
+    T* _elem;       // 指向内部存储或堆空间
+    typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type _inline; // 内部存储
+
+    T* inlineElem() { return reinterpret_cast<T*>(&_inline); }
+    bool isInline() const { return _elem == reinterpret_cast<T const*>(&_inline); }
+
+    void destroy(Rank lo, Rank hi) { while (lo < hi) _elem[lo++].~T(); }
+
+    /* 扩容至不小于 c：移动至新的堆空间 */
+    void grow(int c) {
+        if (c <= _capacity) return;
+        if (c < (_capacity << 1)) c = _capacity << 1;
+        T* p = static_cast<T*>(std::malloc(sizeof(T) * c));
+        if (!p) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(T) * c);
+        for (Rank i = 0; i < _size; ++i) { new (p + i) T(std::move_if_noexcept(_elem[i])); _elem[i].~T(); }
+        if (!isInline()) std::free(_elem);
+        _elem = p; _capacity = c;
+    }
+
+    /* 接管 S 的元素：S 在堆上则直接接过空间，否则逐个移动；S 随后为空 */
+    void steal(SmallVector& S) {
+        if (S.isInline()) {
+            _elem = inlineElem(); _capacity = N;
+            for (_size = 0; _size < S._size; ++_size) new (_elem + _size) T(std::move(S._elem[_size]));
+            S.destroy(0, S._size);
+        } else {
+            _elem = S._elem; _capacity = S._capacity; _size = S._size;
+            S._elem = S.inlineElem(); S._capacity = N;
+        }
+        S._size = 0;
+    }
+
+public:
+    /* 构造函数 */
+    SmallVector() : _size(0), _capacity(N), _elem(inlineElem()) {}
+    SmallVector(Rank s, T const& v) : _size(0), _capacity(N), _elem(inlineElem()) // s 个 v
+    { grow(s); for (; _size < s; ++_size) new (_elem + _size) T(v); }
+    SmallVector(SmallVector const& S) : _size(0), _capacity(N), _elem(inlineElem())
+    { grow(S._size); for (; _size < S._size; ++_size) new (_elem + _size) T(S._elem[_size]); }
+    SmallVector(SmallVector&& S) { steal(S); }
+
+    /* 析构函数 */
+    ~SmallVector() { destroy(0, _size); if (!isInline()) std::free(_elem); }
+
+    SmallVector& operator=(SmallVector const& S) {
+        if (this != &S) { SmallVector t(S); *this = std::move(t); }
+        return *this;
+    }
+    SmallVector& operator=(SmallVector&& S) {
+        if (this != &S) { this->~SmallVector(); steal(S); }
+        return *this;
+    }
+
+    /* 只读访问接口 */
+    Rank size() const { return _size; }
+    int capacity() const { return _capacity; }
+    bool empty() const { return !_size; }
+    Rank find(T const& e) const { return find(e, 0, _size); }
+    Rank find(T const& e, Rank lo, Rank hi) const // 无序区间查找：返回秩最大者，失败返回 lo - 1
+    { while ((lo < hi--) && !(e == _elem[hi])); return hi; }
+    T* data() const { return _elem; }
+
+    /* 可写访问接口 */
+    T& operator[](Rank r) { return _elem[r]; }
+    T const& operator[](Rank r) const { return _elem[r]; }
+    void reserve(int c) { grow(c); }
+    Rank insert(Rank r, T const& e) { return emplace(r, e); }
+    Rank insert(Rank r, T&& e) { return emplace(r, std::move(e)); }
+    Rank insert(T const& e) { return emplace(_size, e); }
+    Rank insert(T&& e) { return emplace(_size, std::move(e)); }
+    template <typename... Args>
+    Rank emplace(Rank r, Args&&... args) { // 在秩 r 处就地构造新元素
+        T x(std::forward<Args>(args)...); // 先行构造，以免实参引用本向量的元素
+        grow(_size + 1);
+        if (r == _size) { new (_elem + _size) T(std::move(x)); }
+        else {
+            new (_elem + _size) T(std::move(_elem[_size - 1]));
+            for (Rank i = _size - 1; r < i; --i) _elem[i] = std::move(_elem[i - 1]);
+            _elem[r] = std::move(x);
+        }
+        ++_size;
+        return r;
+    }
+    template <typename... Args>
+    Rank emplace_back(Args&&... args) { return emplace(_size, std::forward<Args>(args)...); }
+    int remove(Rank lo, Rank hi) { // 删除区间 [lo, hi)
+        if (lo == hi) return 0;
+        Rank n = _size;
+        while (hi < n) _elem[lo++] = std::move(_elem[hi++]);
+        destroy(lo, n); _size = lo;
+        return hi - lo;
+    }
+    T remove(Rank r) { T e = std::move(_elem[r]); remove(r, r + 1); return e; }
+    void clear() { destroy(0, _size); _size = 0; }
+
+    /* 遍历 */
+    void traverse(void (*visit)(T&)) { for (Rank i = 0; i < _size; ++i) visit(_elem[i]); }
+    template <typename VST>
+    void traverse(VST& visit) { for (Rank i = 0; i < _size; ++i) visit(_elem[i]); }
+};
+
+#endif // MYLIBRARY_SMALLVECTOR_H
@@ -0,0 +1,169 @@
+#ifndef MYLIBRARY_SOAVECTOR_H
+#define MYLIBRARY_SOAVECTOR_H
+
+#include "Vector.h"
+#include <tuple>
+
+#define SOA_ALIGN 64 // 各列起点按缓存行对齐，亦满足 AVX 对齐加载的要求
+
+/* 编译期下标序列 0, 1, ..., N - 1，用于逐列展开 */
+template <int... Is> struct SoAIndices {};
+template <int N, int... Is> struct SoAMakeIndices : SoAMakeIndices<N - 1, N - 1, Is...> {};
+template <int... Is> struct SoAMakeIndices<0, Is...> { typedef SoAIndices<Is...> type; };
+
+/* 各字段是否均可平凡复制 */
+template <typename... Fs> struct SoATrivial : std::true_type {};
+template <typename F, typename... Fs> struct SoATrivial<F, Fs...>
+    : std::integral_constant<bool, std::is_trivially_copyable<F>::value && SoATrivial<Fs...>::value> {};
+
+/* 按列存放的记录向量（structure of arrays）：第 I 个字段的所有值连续存放于同一数组
+   - 只访问部分字段的扫描只读入相应的列，column<I>() 给出对齐的列首指针，可直接交给向量化的循环
+   - 所有列共用一块空间，按容量分段；扩容时逐列整体搬迁
+   - 按某列排序时先求出置换，再将同一置换施加于每一列
+   - 各字段须可平凡复制 */
+template <typename... Fields>
+class SoAVector {
+public:
+    static const int FIELDS = sizeof...(Fields);
+    template <int I>
+    struct Field { typedef typename std::tuple_element<I, std::tuple<Fields...> >::type type; }; // 第 I 个字段的类型
+    typedef std::tuple<Fields...> Row;
+
+private:
+    Rank _size; int _capacity;
+    void* _block;           // 各列所在的整块空间
+    char* _col[FIELDS];     // 各列首地址
+
+    static size_t fieldSize(int f) { static const size_t s[] = { sizeof(Fields)... }; return s[f]; }
+    static size_t columnBytes(int f, int c) // 列所占字节数，补齐至 SOA_ALIGN 的整数倍
+    { return (fieldSize(f) * c + SOA_ALIGN - 1) / SOA_ALIGN * SOA_ALIGN; }
+
+    void reallocate(int c) { // 容量调整为 c，保留 [0, _size)
+        size_t total = SOA_ALIGN; // 预留对齐所需的余量
+        for (int f = 0; f < FIELDS; ++f) total += columnBytes(f, c);
+        void* block = std::malloc(total);
+        if (!block) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, total);
+        char* p = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(block) + SOA_ALIGN - 1) / SOA_ALIGN * SOA_ALIGN);
+        for (int f = 0; f < FIELDS; ++f) {
+            if (_size) std::memcpy(p, _col[f], fieldSize(f) * _size);
+            _col[f] = p;
+            p += columnBytes(f, c);
+        }
+        std::free(_block);
+        _block = block; _capacity = c;
+    }
+    void expand() { if (_size == _capacity) reallocate(_capacity < DEFAULT_CAPACITY ? DEFAULT_CAPACITY << 1 : _capacity << 1); }
+
+    template <int... Is>
+    void store(Rank r, SoAIndices<Is...>, Fields const&... v) {
+        int dummy[] = { 0, ((column<Is>()[r] = v), 0)... };
+        (void) dummy;
+    }
+    template <int... Is>
+    Row load(Rank r, SoAIndices<Is...>) const { return Row(column<Is>()[r]...); }
+
+    template <typename K, bool Desc>
+    struct KeyRank { // 排序用的（关键码，原秩）对，以原秩打破平局，故排序稳定
+        K key; Rank r;
+        bool operator<(KeyRank const& b) const {
+            if (Desc ? (b.key < key) : (key < b.key)) return true;
+            if (Desc ? (key < b.key) : (b.key < key)) return false;
+            return r < b.r;
+        }
+    };
+    template <int I, bool Desc>
+    void sortByKey() {
+        typedef KeyRank<typename Field<I>::type, Desc> KR;
+        Vector<KR> keys;
+        keys.reserve(_size);
+        typename Field<I>::type const* k = column<I>();
+        for (Rank i = 0; i < _size; ++i) { KR e = { k[i], i }; keys.insert(e); }
+        keys.sort(); // 关键码各异，内省排序即可保证稳定
+        Vector<Rank> perm(_size, _size, 0);
+        for (Rank i = 0; i < _size; ++i) perm[i] = keys[i].r;
+        permute(perm.data());
+    }
+
+public:
+    SoAVector(int c = DEFAULT_CAPACITY) : _size(0), _capacity(0), _block(NULL) {
+        static_assert(sizeof...(Fields) > 0, "SoAVector requires at least one field");
+        static_assert(SoATrivial<Fields...>::value, "SoAVector requires trivially copyable fields");
+        reallocate(c < 1 ? 1 : c);
+    }
+    SoAVector(SoAVector const& V) : _size(0), _capacity(0), _block(NULL) { *this = V; }
+    SoAVector(SoAVector&& V) : _size(V._size), _capacity(V._capacity), _block(V._block) {
+        for (int f = 0; f < FIELDS; ++f) _col[f] = V._col[f];
+        V._block = NULL; V._size = V._capacity = 0;
+    }
+    ~SoAVector() { std::free(_block); }
+
+    SoAVector& operator=(SoAVector const& V) {
+        if (this == &V) return *this;
+        _size = 0;
+        if (_capacity < V._size || !_block) reallocate(V._size < 1 ? 1 : V._size);
+        for (int f = 0; f < FIELDS; ++f) std::memcpy(_col[f], V._col[f], fieldSize(f) * V._size);
+        _size = V._size;
+        return *this;
+    }
+    SoAVector& operator=(SoAVector&& V) {
+        if (this == &V) return *this;
+        std::free(_block);
+        _block = V._block; _size = V._size; _capacity = V._capacity;
+        for (int f = 0; f < FIELDS; ++f) _col[f] = V._col[f];
+        V._block = NULL; V._size = V._capacity = 0;
+        return *this;
+    }
+
+    /* 规模与容量 */
+    Rank size() const { return _size; }
+    int capacity() const { return _capacity; }
+    bool empty() const { return !_size; }
+    void reserve(int c) { if (c > _capacity) reallocate(c); }
+    void clear() { _size = 0; }
+
+    /* 列访问：返回第 I 列的首地址（按 SOA_ALIGN 对齐），有效范围 [0, size()) */
+    template <int I>
+    typename Field<I>::type* column() { return reinterpret_cast<typename Field<I>::type*>(_col[I]); }
+    template <int I>
+    typename Field<I>::type const* column() const { return reinterpret_cast<typename Field<I>::type const*>(_col[I]); }
+    template <int I>
+    typename Field<I>::type& get(Rank r) { return column<I>()[r]; }
+    template <int I>
+    typename Field<I>::type const& get(Rank r) const { return column<I>()[r]; }
+
+    /* 行访问：整行读出、改写或追加 */
+    Row row(Rank r) const { return load(r, typename SoAMakeIndices<FIELDS>::type()); }
+    void set(Rank r, Fields const&... v) { store(r, typename SoAMakeIndices<FIELDS>::type(), v...); }
+    Rank insert(Fields const&... v) { // 尾部追加一行，返回其秩
+        expand();
+        store(_size, typename SoAMakeIndices<FIELDS>::type(), v...);
+        return _size++;
+    }
+    Rank remove(Rank lo, Rank hi) { // 删除 [lo, hi) 诸行，返回删除的行数
+        for (int f = 0; f < FIELDS; ++f)
+            std::memmove(_col[f] + fieldSize(f) * lo, _col[f] + fieldSize(f) * hi, fieldSize(f) * (_size - hi));
+        _size -= hi - lo;
+        return hi - lo;
+    }
+
+    /* 重排：第 i 行改为原第 perm[i] 行（perm 为 [0, size()) 的一个置换）；逐列经缓冲区收集 */
+    void permute(Rank const* perm) {
+        size_t widest = 0;
+        for (int f = 0; f < FIELDS; ++f) if (widest < fieldSize(f)) widest = fieldSize(f);
+        char* buf = static_cast<char*>(std::malloc(widest * (_size < 1 ? 1 : _size)));
+        if (!buf) throw std::bad_alloc();
+        for (int f = 0; f < FIELDS; ++f) {
+            size_t s = fieldSize(f);
+            for (Rank i = 0; i < _size; ++i) std::memcpy(buf + s * i, _col[f] + s * perm[i], s);
+            std::memcpy(_col[f], buf, s * _size);
+        }
+        std::free(buf);
+    }
+
+    /* 按第 I 列稳定排序，各列随之重排 */
+    template <int I>
+    void sortBy(bool descending = false) { if (descending) sortByKey<I, true>(); else sortByKey<I, false>(); }
+};
+
+#endif // MYLIBRARY_SOAVECTOR_H
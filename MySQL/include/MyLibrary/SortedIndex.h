@@ -0,0 +1,131 @@
+#ifndef MYLIBRARY_SORTEDINDEX_H
+#define MYLIBRARY_SORTEDINDEX_H
+
+#include "Vector.h"
+#include <cstdint>
+
+#define SORTED_INDEX_LINE 64   // 缓存行字节数
+#define SORTED_INDEX_BATCH 16  // 批量查找时交错推进的查询数
+
+#if defined(__GNUC__)
+#define SORTED_INDEX_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define SORTED_INDEX_PREFETCH(p) ((void) 0)
+#endif
+
+/* 有序向量的只读静态查找索引（Eytzinger 布局）
+   - 关键码按完全二叉树的层次次序存放：根在 1 号单元，k 号的孩子为 2k、2k + 1。
+     自顶而下的查找路径集中在数组前部，前几层常驻缓存
+   - 每层只做一次比较，以比较结果直接算出下一单元，无分支；
+     同时预取若干层之后的整条缓存行，掩盖访存延迟
+   - 最末一层不满时以末元素补齐，并令越界单元一律“向右”，于是各查询的迭代次数相同，
+     批量查找可交错推进多个查询
+   - 查找语义与 binSearch 一致：返回不大于 e 的最大秩，e 小于全部元素时返回 -1 */
+template <typename T>
+class SortedIndex {
+private:
+    Rank _n;        // 元素数
+    int _height;    // 层数，每次查找恰好迭代 _height 次
+    unsigned _cap;  // 单元数 2^_height，单元 [1, _cap) 均已构造
+    void* _raw;     // 未对齐的原始空间
+    T* _b;          // 按 Eytzinger 次序存放的关键码（首地址按缓存行对齐）
+    Rank _last;     // 末层实有的单元数
+
+    enum { STRIDE = (SORTED_INDEX_LINE / sizeof(T)) ? SORTED_INDEX_LINE / sizeof(T) : 1 };
+
+    /* 中序遍历 Eytzinger 树，依次填入 A[0, n) */
+    void build(T const* A, Rank& i, unsigned k) {
+        if (k > (unsigned) _n) return;
+        build(A, i, 2 * k);
+        new (_b + k) T(A[i++]);
+        build(A, i, 2 * k + 1);
+    }
+
+    /* 下降一层：越界单元视为不大于 e（向右），两个条件都求值以免分支 */
+    unsigned step(T const& e, unsigned k) const {
+        SORTED_INDEX_PREFETCH(_b + (std::size_t) k * STRIDE);
+        return 2 * k + ((k > (unsigned) _n) | !(e < _b[k]));
+    }
+
+    /* 末次向左转处即首个大于 e 的单元：去掉路径末尾连续的右转及最后一次左转，
+       再将该单元换算为秩，减一即得不大于 e 的最大秩 */
+    Rank finish(unsigned k) const {
+#if defined(__GNUC__)
+        k >>= __builtin_ffs(~k);
+#else
+        while (k & 1) k >>= 1;
+        k >>= 1;
+#endif
+        return k ? rankOf(k) - 1 : _n - 1;
+    }
+
+    /* 单元 k 的中序秩：先按满树计算，再扣除中序位于其前、末层缺失的单元
+       （满树末层第 j 个单元的中序秩为 2j，实有者为 j < _last） */
+    Rank rankOf(unsigned k) const {
+#if defined(__GNUC__)
+        int l = 31 - __builtin_clz(k); // k 所在层
+#else
+        int l = 0;
+        while (k >> (l + 1)) ++l;
+#endif
+        long long r = ((2LL * (k - (1u << l)) + 1) << (_height - 1 - l)) - 1;
+        long long missing = (r + 1) / 2 - _last;
+        return Rank(missing > 0 ? r - missing : r);
+    }
+
+    SortedIndex(SortedIndex const&) = delete;
+    SortedIndex& operator=(SortedIndex const&) = delete;
+
+public:
+    SortedIndex(T const* A, Rank n) { init(A, n); }
+    explicit SortedIndex(Vector<T> const& V) { init(V.data(), V.size()); }
+    ~SortedIndex() {
+        for (unsigned k = 1; k < _cap; ++k) _b[k].~T();
+        std::free(_raw);
+    }
+
+    Rank size() const { return _n; }
+
+    /* 单个查找 */
+    Rank search(T const& e) const {
+        unsigned k = 1;
+        for (int l = 0; l < _height; ++l) k = step(e, k);
+        return finish(k);
+    }
+
+    /* 批量查找：out[i] = search(keys[i])。每组 SORTED_INDEX_BATCH 个查询逐层交错推进，
+       多个访存请求同时在途 */
+    void lookup(T const* keys, Rank m, Rank* out) const {
+        unsigned k[SORTED_INDEX_BATCH];
+        for (Rank i = 0; i < m; i += SORTED_INDEX_BATCH) {
+            int g = (m - i < SORTED_INDEX_BATCH) ? m - i : SORTED_INDEX_BATCH;
+            T const* q = keys + i;
+            for (int j = 0; j < g; ++j) k[j] = 1;
+            for (int l = 0; l < _height; ++l)
+                for (int j = 0; j < g; ++j) k[j] = step(q[j], k[j]);
+            for (int j = 0; j < g; ++j) out[i + j] = finish(k[j]);
+        }
+    }
+
+    void lookup(Vector<T> const& keys, Vector<Rank>& out) const {
+        out = Vector<Rank>(keys.size(), keys.size(), -1);
+        lookup(keys.data(), keys.size(), out.data());
+    }
+
+private:
+    void init(T const* A, Rank n) {
+        _n = n;
+        for (_height = 0; (1LL << _height) <= n; ++_height); // 层数 = floor(log2 n) + 1
+        _cap = 1u << _height;
+        _raw = std::malloc(sizeof(T) * _cap + SORTED_INDEX_LINE);
+        if (!_raw) throw std::bad_alloc();
+        OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, sizeof(T) * _cap + SORTED_INDEX_LINE);
+        _b = reinterpret_cast<T*>(((std::uintptr_t) _raw + SORTED_INDEX_LINE - 1) & ~(std::uintptr_t) (SORTED_INDEX_LINE - 1));
+        _last = n - (Rank(_cap >> 1) - 1);
+        Rank i = 0;
+        build(A, i, 1);
+        for (unsigned k = n + 1; k < _cap; ++k) new (_b + k) T(A[n - 1]); // 补齐末层，其值不参与判定
+    }
+};
+
+#endif // MYLIBRARY_SORTEDINDEX_H
@@ -0,0 +1,307 @@
+#ifndef MYLIBRARY_UNROLLEDLIST_H
+#define MYLIBRARY_UNROLLEDLIST_H
+
+#include "Vector.h"   // 排序借助向量；块内查找、逆序计数借助 SimdScan
+#include "NodePool.h" // 块取自节点池
+
+#define UNROLLED_BLOCK 64 // 每块缺省容纳的元素数
+
+/* 展开链表的块：双向链接，块内元素连续存放于 [0, n) */
+template <typename T, int B>
+struct UnrolledBlock {
+    UnrolledBlock* pred; UnrolledBlock* succ; int n;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type slot[B];
+
+    UnrolledBlock() : pred(NULL), succ(NULL), n(0) {}
+    ~UnrolledBlock() { for (int i = 0; i < n; ++i) at(i).~T(); }
+    T* elems() { return reinterpret_cast<T*>(slot); }
+    T& at(int i) { return elems()[i]; }
+};
+
+/* 展开链表中的位置：所在块与块内下标；块为 NULL 者不指向任何元素 */
+template <typename T, int B>
+struct UnrolledPosi {
+    UnrolledBlock<T, B>* block; int index;
+    T& data() const { return block->at(index); }
+    bool operator==(UnrolledPosi const& p) const { return block == p.block && index == p.index; }
+    bool operator!=(UnrolledPosi const& p) const { return !(*this == p); }
+};
+
+/* 展开链表：每个节点（块）存放至多 B 个连续元素，接口与 List 相仿
+   - 顺序遍历每 B 个元素才跟随一次指针，查找、遍历的缓存命中率接近向量
+   - 插入时块满则对半分裂（在末块之尾追加时改为另起新块）；删除后块不足半满，
+     则与后继块合并或从其借入元素，故除末块外各块均至少半满
+   - 位置由（块，下标）表示；任何插入、删除、排序之后，此前取得的位置均失效 */
+template <typename T, int B = UNROLLED_BLOCK, typename Alloc = NodePool<UnrolledBlock<T, B> > >
+class UnrolledList {
+public:
+    typedef UnrolledBlock<T, B> Block;
+    typedef UnrolledPosi<T, B> Posi;
+
+private:
+    int _size; Block* _head; Block* _tail; // 规模、首块、末块
+    Alloc _alloc;
+
+    static Posi posi(Block* b, int i) { Posi p = { b, i }; return p; }
+
+    /* 块内元素搬移：目标位置均为未构造的空槽，源位置搬移后即析构；块的规模由调用者维护 */
+    static void move(T* dst, T* src, int k) { for (int i = 0; i < k; ++i) { new (dst + i) T(std::move(src[i])); src[i].~T(); } }
+    static void shiftRight(Block* b, int i, int k) { // [i, n) 右移 k 位，空出 [i, i + k)
+        for (int j = b->n - 1; i <= j; --j) { new (&b->at(j + k)) T(std::move(b->at(j))); b->at(j).~T(); }
+    }
+    static void shiftLeft(Block* b, int i, int k) { move(b->elems() + i, b->elems() + i + k, b->n - i - k); } // [i + k, n) 左移 k 位
+
+    Block* newBlockAfter(Block* b) { // 在块 b 之后（b 为 NULL 时在最前）插入空块
+        Block* x = _alloc.create();
+        x->pred = b; x->succ = b ? b->succ : _head;
+        (x->succ ? x->succ->pred : _tail) = x;
+        (b ? b->succ : _head) = x;
+        return x;
+    }
+    void freeBlock(Block* b) {
+        (b->pred ? b->pred->succ : _head) = b->succ;
+        (b->succ ? b->succ->pred : _tail) = b->pred;
+        _alloc.destroy(b);
+    }
+
+    void copyFrom(UnrolledList const& L) { // 追加 L 的全部元素，逐块照搬 L 的分块（故仍满足半满约定）
+        try {
+            for (Block* b = L._head; b; b = b->succ) {
+                Block* x = newBlockAfter(_tail);
+                for (; x->n < b->n; ++x->n, ++_size) new (&x->at(x->n)) T(b->at(x->n));
+            }
+        } catch (...) { clear(); throw; } // 元素复制失败：已复制者一并释放，列表为空
+    }
+
+    Posi insertAt(Block* b, int i, T const& e); // 在块 b 的下标 i 处插入
+    void rebalance(Block* b);                   // 块 b 不足半满时与后继块合并或借入
+    template <typename Keep>
+    int compact(Keep keep);                     // 按序保留 keep 认可的元素，返回删除数
+    int deduplicate(std::true_type) { return deduplicate(std::hash<T>(), std::equal_to<T>()); }
+    int deduplicate(std::false_type);
+
+public:
+    // 构造与析构
+    UnrolledList() : _size(0), _head(NULL), _tail(NULL) {}
+    explicit UnrolledList(Alloc const& alloc) : _size(0), _head(NULL), _tail(NULL), _alloc(alloc) {}
+    UnrolledList(UnrolledList const& L) : _size(0), _head(NULL), _tail(NULL) { copyFrom(L); } // 副本另建节点池，不与 L 共享
+    ~UnrolledList() { clear(); }
+    UnrolledList& operator=(UnrolledList const& L) { if (this != &L) { clear(); copyFrom(L); } return *this; } // 沿用本列表的节点池
+
+    // 只读访问接口
+    Rank size() const { return _size; }
+    bool empty() const { return _size <= 0; }
+    Alloc const& allocator() const { return _alloc; }
+    T& operator[](Rank r) const { return locate(r).data(); } // 循秩访问，逐块跳过，O(n / B)
+    Posi locate(Rank r) const; // 秩为 r 的元素的位置
+    Posi first() const { return posi(_head, 0); }
+    Posi last() const { return _tail ? posi(_tail, _tail->n - 1) : posi(NULL, 0); }
+    Posi next(Posi p) const { return (p.index + 1 < p.block->n) ? posi(p.block, p.index + 1) : posi(p.block->succ, 0); }
+    Posi prev(Posi p) const { return p.index ? posi(p.block, p.index - 1) : posi(p.block->pred, p.block->pred ? p.block->pred->n - 1 : 0); }
+    bool valid(Posi p) const { return p.block != NULL; }
+    int disordered() const; // 相邻逆序对数
+    Posi find(T const& e) const; // 无序查找：最后一个等于 e 者，失败时返回无效位置
+    Posi search(T const& e) const; // 有序查找：最后一个不大于 e 者，失败时返回无效位置
+
+    // 可写访问接口
+    Posi insertAsFirst(T const& e) { return _head ? insertAt(_head, 0, e) : insertAt(newBlockAfter(NULL), 0, e); }
+    Posi insertAsLast(T const& e) { return _tail ? insertAt(_tail, _tail->n, e) : insertAt(newBlockAfter(NULL), 0, e); }
+    Posi insertBefore(Posi p, T const& e) { return insertAt(p.block, p.index, e); }
+    Posi insertAfter(Posi p, T const& e) { return insertAt(p.block, p.index + 1, e); }
+    T remove(Posi p); // 删除位置 p 处的元素并返回之
+    int clear();
+    void sort(SortPolicy policy = SORT_INTRO); // 元素整体移入向量排序后依次填满各块
+    int deduplicate() { return deduplicate(typename HasStdHash<T>::type()); } // 无序去重，保留首次出现者
+    template <typename Hash, typename Eq> int deduplicate(Hash hash, Eq eq);
+    int uniquify(); // 有序去重
+    void reverse(); // 前后倒置
+
+    // 遍历
+    void traverse(void (*visit)(T&)) const
+    { for (Block* b = _head; b; b = b->succ) for (int i = 0; i < b->n; ++i) visit(b->at(i)); }
+    template <typename VST> void traverse(VST& visit) const
+    { for (Block* b = _head; b; b = b->succ) for (int i = 0; i < b->n; ++i) visit(b->at(i)); }
+};
+
+template <typename T, int B, typename A>
+typename UnrolledList<T, B, A>::Posi UnrolledList<T, B, A>::insertAt(Block* b, int i, T const& e) {
+    if (b->n == B && b == _tail && i == B) { // 末块已满而追加于其尾，另起新块
+        b = newBlockAfter(b); i = 0;
+    } else if (b->n == B) { // 块满，对半分裂
+        Block* x = newBlockAfter(b);
+        move(x->elems(), b->elems() + B / 2, B - B / 2);
+        x->n = B - B / 2; b->n = B / 2;
+        if (B / 2 < i) { b = x; i -= B / 2; }
+    }
+    shiftRight(b, i, 1);
+    new (&b->at(i)) T(e);
+    b->n++; _size++;
+    return posi(b, i);
+}
+
+template <typename T, int B, typename A>
+T UnrolledList<T, B, A>::remove(Posi p) {
+    Block* b = p.block;
+    T e = std::move(b->at(p.index));
+    b->at(p.index).~T();
+    shiftLeft(b, p.index, 1);
+    b->n--; _size--;
+    rebalance(b);
+    return e;
+}
+
+template <typename T, int B, typename A>
+void UnrolledList<T, B, A>::rebalance(Block* b) {
+    if (!b->n) { freeBlock(b); return; }
+    if (B / 2 <= b->n || b == _tail) return; // 末块允许不足半满
+    Block* s = b->succ;
+    if (b->n + s->n <= B) { // 后继并入本块
+        move(b->elems() + b->n, s->elems(), s->n);
+        b->n += s->n; s->n = 0;
+        freeBlock(s);
+    } else { // 从后继借入其前部，两块各自至少半满
+        int k = (s->n - b->n) / 2;
+        move(b->elems() + b->n, s->elems(), k);
+        shiftLeft(s, 0, k);
+        b->n += k; s->n -= k;
+    }
+}
+
+template <typename T, int B, typename A>
+int UnrolledList<T, B, A>::clear() {
+    int oldSize = _size;
+    while (_head) freeBlock(_head);
+    _size = 0;
+    return oldSize;
+}
+
+template <typename T, int B, typename A>
+typename UnrolledList<T, B, A>::Posi UnrolledList<T, B, A>::locate(Rank r) const {
+    Block* b = _head;
+    while (b->n <= r) { r -= b->n; b = b->succ; }
+    return posi(b, r);
+}
+
+template <typename T, int B, typename A>
+int UnrolledList<T, B, A>::disordered() const {
+    int c = 0;
+    for (Block* b = _head; b; b = b->succ) {
+        c += scanDisordered(b->elems(), b->n);
+        if (b->succ && b->succ->at(0) < b->at(b->n - 1)) ++c; // 块间相邻者
+    }
+    return c;
+}
+
+template <typename T, int B, typename A>
+typename UnrolledList<T, B, A>::Posi UnrolledList<T, B, A>::find(T const& e) const {
+    for (Block* b = _tail; b; b = b->pred) {
+        Rank i = scanFind(b->elems(), e, 0, b->n);
+        if (0 <= i) return posi(b, i);
+    }
+    return posi(NULL, 0);
+}
+
+template <typename T, int B, typename A>
+typename UnrolledList<T, B, A>::Posi UnrolledList<T, B, A>::search(T const& e) const {
+    for (Block* b = _tail; b; b = b->pred) // 自后向前找到首元素不大于 e 的块，再于块内二分
+        if (!(e < b->at(0))) return posi(b, binSearch(b->elems(), e, 0, b->n));
+    return posi(NULL, 0);
+}
+
+/* 一趟压缩：读、写两个位置自前向后推进，待定元素先移至写位置，获准保留则写位置前进；
+   写位置不超过读位置，故写位置上的元素或已移走、或未获保留，均可覆盖。
+   除最后一块外各块规模不变，末块不足半满时再行调整 */
+template <typename T, int B, typename A> template <typename Keep>
+int UnrolledList<T, B, A>::compact(Keep keep) {
+    if (!_head) return 0;
+    Block* wb = _head; int wi = 0;
+    for (Block* rb = _head; rb; rb = rb->succ)
+        for (int ri = 0; ri < rb->n; ++ri) {
+            if (rb != wb || ri != wi) wb->at(wi) = std::move(rb->at(ri));
+            if (keep(wb->at(wi)) && ++wi == wb->n && wb->succ) { wb = wb->succ; wi = 0; }
+        }
+    int oldSize = _size;
+    if (wi < wb->n) { // 截去写位置及其后的元素
+        for (int i = wi; i < wb->n; ++i) wb->at(i).~T();
+        _size -= wb->n - wi; wb->n = wi;
+    }
+    while (wb->succ) { _size -= wb->succ->n; freeBlock(wb->succ); }
+    rebalance(wb);
+    return oldSize - _size;
+}
+
+/* 供 compact 使用的判定器 */
+template <typename T, typename Hash, typename Eq>
+struct UnrolledFirstSeen { // 散列表中尚无雷同者
+    DedupTable<T, Hash, Eq>* seen;
+    bool operator()(T const& e) { return seen->insert(e); }
+};
+template <typename T, typename L>
+struct UnrolledFirstScanned { // 已保留的前缀中尚无雷同者（逐一比对）
+    L* list; int kept;
+    bool operator()(T const& e) {
+        int r = 0;
+        for (typename L::Block* b = list->first().block; r < kept; b = b->succ)
+            for (int i = 0; i < b->n && r < kept; ++i, ++r) if (b->at(i) == e) return false;
+        ++kept;
+        return true;
+    }
+};
+template <typename T>
+struct UnrolledDistinct { // 与上一保留者不同
+    T const* last;
+    bool operator()(T const& e) { if (last && *last == e) return false; last = &e; return true; }
+};
+
+template <typename T, int B, typename A> template <typename Hash, typename Eq>
+int UnrolledList<T, B, A>::deduplicate(Hash hash, Eq eq) { // O(n)
+    if (_size < 2) return 0;
+    DedupTable<T, Hash, Eq> seen(_size, hash, eq);
+    UnrolledFirstSeen<T, Hash, Eq> keep = { &seen };
+    return compact(keep);
+}
+
+template <typename T, int B, typename A>
+int UnrolledList<T, B, A>::deduplicate(std::false_type) { // O(n^2)
+    if (_size < 2) return 0;
+    UnrolledFirstScanned<T, UnrolledList> keep = { this, 0 };
+    return compact(keep);
+}
+
+template <typename T, int B, typename A>
+int UnrolledList<T, B, A>::uniquify() {
+    if (_size < 2) return 0;
+    UnrolledDistinct<T> keep = { NULL };
+    return compact(keep);
+}
+
+template <typename T, int B, typename A>
+void UnrolledList<T, B, A>::sort(SortPolicy policy) {
+    if (_size < 2) return;
+    Vector<T> V;
+    V.reserve(_size);
+    for (Block* b = _head; b; b = b->succ)
+        for (int i = 0; i < b->n; ++i) V.insert(std::move(b->at(i)));
+    V.sort(policy);
+    Rank r = 0; // 依次移回各块，每块填满，多余的块释放
+    for (Block* b = _head; b; b = b->succ) {
+        for (int i = 0; i < b->n; ++i) b->at(i).~T();
+        b->n = 0;
+        while (b->n < B && r < V.size()) new (&b->at(b->n++)) T(std::move(V[r++]));
+    }
+    while (_tail && !_tail->n) freeBlock(_tail);
+}
+
+template <typename T, int B, typename A>
+void UnrolledList<T, B, A>::reverse() {
+    for (Block* b = _head; b; ) { // 各块内倒置，并交换各块的前后链接
+        for (int i = 0, j = b->n - 1; i < j; ++i, --j) countedSwap(b->at(i), b->at(j));
+        Block* s = b->succ;
+        b->succ = b->pred; b->pred = s;
+        b = s;
+    }
+    Block* h = _head; _head = _tail; _tail = h;
+    if (_head) rebalance(_head); // 原末块成为首块，可能不足半满
+}
+
+#endif // MYLIBRARY_UNROLLEDLIST_H
@@ -1,85 +1,233 @@
 #ifndef MYLIBRARY_VECTOR_H
 #define MYLIBRARY_VECTOR_H
 
+#include <cstdlib>      // malloc / realloc / free
+#include <cstring>      // memcpy
+#include <cstdio>
+#include <ctime>
+#include <new>          // placement new, bad_alloc
+#include <utility>      // move, forward
+#include <algorithm>    // swap, move_backward
+#include <type_traits>  // is_trivially_copyable
+#include <functional>   // less
+#include <cstdint>      // uint32_t, uint64_t
+#include "Dedup.h"      // 散列去重
+#include "OpStats.h"    // 操作计数
+#include "VectorFile.h" // 向量文件格式
+#include "Random.h"     // 可播种的伪随机数发生器
+#include "SimdScan.h"   // 查找、逆序计数与归约的向量化实现
+
 typedef int Rank;               // 秩
 #define DEFAULT_CAPACITY 3      // 默认初始容量（最小容量）
+#define INSERTION_SORT_THRESHOLD 16 // 内省排序中改用插入排序的区间规模
+
+/* 基数排序关键码编码：将整数 / IEEE 浮点关键码映射为无符号整数，使其无符号次序与原次序一致 */
+template <typename K, bool = std::is_floating_point<K>::value>
+struct RadixKey { // 整数：有符号者翻转符号位
+    typedef typename std::conditional<sizeof(K) <= 4, uint32_t, uint64_t>::type type;
+    static type encode(K k) {
+        type u = static_cast<type>(k);
+        return std::is_signed<K>::value ? u ^ (type(1) << (sizeof(type) * 8 - 1)) : u;
+    }
+};
+
+template <typename K>
+struct RadixKey<K, true> { // 浮点：负数全部取反，非负数仅置符号位（-0 排在 +0 之前，NaN 排在两端）
+    typedef typename std::conditional<sizeof(K) <= 4, uint32_t, uint64_t>::type type;
+    static type encode(K k) {
+        type u; std::memcpy(&u, &k, sizeof(u));
+        type sign = type(1) << (sizeof(type) * 8 - 1);
+        return (u & sign) ? ~u : (u | sign);
+    }
+};
+
+/* 排序策略：默认采用确定性的内省排序，其余算法保留以便对比测试 */
+typedef enum {
+    SORT_INTRO, SORT_BUBBLE, SORT_SELECTION, SORT_INSERTION,
+    SORT_MERGE, SORT_HEAP, SORT_QUICK
+} SortPolicy;
 
 template <typename T>
 class Vector {                  // 向量模板类
 protected:
     Rank _size;                 // 当前规模
     int  _capacity;             // 当前容量
-    T*   _elem;                 // 数据区首地址
+    T*   _elem;                 // 数据区首地址（原始空间，仅 [0, _size) 已构造）
+
+    typedef typename std::is_trivially_copyable<T>::type Trivial; // 可否按字节搬迁
+
+    /* 原始空间管理 */
+    static T* allocate(int c);                          // 申请 c 个元素的未构造空间
+    static void deallocate(T* p) { std::free(p); }      // 释放空间（不析构）
+    void reallocate(int c) { reallocate(c, Trivial()); } // 容量调整为 c，仅搬迁存活元素
+    void reallocate(int c, std::true_type);             // realloc 快速路径
+    void reallocate(int c, std::false_type);            // 逐个移动构造
+    static void construct(T* dst, T const* src, Rank n, std::true_type)
+    { if (n > 0) std::memcpy(static_cast<void*>(dst), src, sizeof(T) * n); }
+    static void construct(T* dst, T const* src, Rank n, std::false_type)
+    { for (Rank i = 0; i < n; ++i) new (dst + i) T(src[i]); }
+    void destroy(Rank lo, Rank hi)                      // 析构区间 [lo, hi)
+    { destroy(lo, hi, typename std::is_trivially_destructible<T>::type()); }
+    void destroy(Rank, Rank, std::true_type) {}
+    void destroy(Rank lo, Rank hi, std::false_type) { while (lo < hi) _elem[lo++].~T(); }
 
     /* 内部工具函数 */
     void copyFrom(T const* A, Rank lo, Rank hi); // 以数组区间 A[lo, hi) 为蓝本复制向量
     void expand();              // 空间不足时扩容
     void shrink();              // 装载因子过小时压缩
     bool bubble(Rank lo, Rank hi);      // 一趟起泡扫描
-    void bubbleSort(Rank lo, Rank hi);  // 起泡排序
     Rank max(Rank lo, Rank hi);         // 选取最大元素
-    void selectionSort(Rank lo, Rank hi);// 选择排序
-    void merge(Rank lo, Rank mi, Rank hi); // 归并
-    void mergeSort(Rank lo, Rank hi);   // 归并排序
+    void merge(Rank lo, Rank mi, Rank hi, T* B); // 归并（B 为暂存左半段的缓冲区）
+    void mergeSort(Rank lo, Rank hi, T* B);      // 归并排序（共用缓冲区 B）
     Rank partition(Rank lo, Rank hi);   // 快速划分
-    void quickSort(Rank lo, Rank hi);   // 快速排序
-    void heapSort(Rank lo, Rank hi);    // 堆排序
+    Rank medianOf3(Rank a, Rank b, Rank c) const; // 三者中位数的秩
+    Rank choosePivot(Rank lo, Rank hi) const;     // 三数取中，大区间采用九数取中
+    void introSort(Rank lo, Rank hi, int depth, bool leftmost); // 内省排序（递归深度超限时转为堆排序）
+    int  deduplicate(std::true_type)    // 可散列：借助 std::hash 去重
+    { return deduplicate(std::hash<T>(), std::equal_to<T>()); }
+    int  deduplicate(std::false_type);  // 不可散列：逐一比对去重
 
 public:
-    
-// 构造函数
-    Vector(int c = DEFAULT_CAPACITY, int s = 0, T v = 0) //容量为c、觃模为s、所有元素刜始为v
-    { _elem = new T[_capacity = c]; for (_size = 0; _size < s; _elem[_size++] = v); } //s <= c
-    Vector(T const* A, Rank lo, Rank hi) { copyFrom(A, lo, hi); } //数组匙间复刢
-    Vector(T const* A, Rank n) { copyFrom(A, 0, n); } //数组整体复刢
-    Vector(Vector<T> const& V, Rank lo, Rank hi) { copyFrom(V._elem, lo, hi); } //向量匙间复刢
-    Vector(Vector<T> const& V) { copyFrom(V._elem, 0, V._size); } //向量整体复刢
+    // 构造函数
+    Vector(int c = DEFAULT_CAPACITY, int s = 0, T const& v = T()) //容量为c、规模为s、所有元素初始为v
+    { _elem = allocate(_capacity = (c > s ? c : s)); for (_size = 0; _size < s; ++_size) new (_elem + _size) T(v); }
+    Vector(T const* A, Rank lo, Rank hi) { copyFrom(A, lo, hi); } //数组区间复制
+    Vector(T const* A, Rank n) { copyFrom(A, 0, n); } //数组整体复制
+    Vector(Vector<T> const& V, Rank lo, Rank hi) { copyFrom(V._elem, lo, hi); } //向量区间复制
+    Vector(Vector<T> const& V) { copyFrom(V._elem, 0, V._size); } //向量整体复制
+    Vector(Vector<T>&& V) : _size(V._size), _capacity(V._capacity), _elem(V._elem) //移动构造：接管V的数据区
+    { V._elem = NULL; V._size = V._capacity = 0; }
 
     /* 析构函数 */
-    ~Vector() { delete[] _elem; }
+    ~Vector() { destroy(0, _size); deallocate(_elem); }
 
     /* 只读接口 */
     Rank size() const { return _size; }
+    int  capacity() const { return _capacity; }
     bool empty() const { return !_size; }
     int  disordered() const;            // 判断向量是否已排序（返回逆序对数）
     Rank find(T const& e) const { return find(e, 0, _size); }
     Rank find(T const& e, Rank lo, Rank hi) const; // 无序区间查找
     Rank search(T const& e) const { return search(e, 0, _size); }
     Rank search(T const& e, Rank lo, Rank hi) const; // 有序区间查找
+    T min() const { return scanMin(_elem, _size); }  // 最小元素（向量非空）
+    T max() const { return scanMax(_elem, _size); }  // 最大元素（向量非空）
+    typename SumOf<T>::type sum() const { return scanSum(_elem, _size); } // 元素之和（整数以 64 位累加）
 
     /* 可写接口 */
-    T&   operator[](Rank r) const;      // 重载下标运算符
+    T& operator[](Rank r) { return _elem[r]; } // 断言: 0 <= r < _size
+    const T& operator[](Rank r) const { return _elem[r]; }
     Vector<T>& operator=(Vector<T> const& V); // 重载赋值
+    Vector<T>& operator=(Vector<T>&& V);      // 移动赋值
     T    remove(Rank r);                // 删除秩为 r 的元素
     int  remove(Rank lo, Rank hi);      // 删除区间 [lo, hi)
-    Rank insert(Rank r, T const& e);    // 在秩 r 处插入 e
-    Rank insert(T const& e) { return insert(_size, e); } // 默认尾插
-    void sort(Rank lo, Rank hi);        // 对区间 [lo, hi) 排序
-    void sort() { sort(0, _size); }     // 整体排序
-    void unsort(Rank lo, Rank hi);      // 将区间 [lo, hi) 随机置乱
+    Rank insert(Rank r, T const& e) { return emplace(r, e); }            // 在秩 r 处插入 e
+    Rank insert(Rank r, T&& e) { return emplace(r, std::move(e)); }
+    Rank insert(T const& e) { return emplace(_size, e); }                // 默认尾插
+    Rank insert(T&& e) { return emplace(_size, std::move(e)); }
+    template <typename... Args>
+    Rank emplace(Rank r, Args&&... args); // 在秩 r 处就地构造新元素
+    template <typename... Args>
+    Rank emplace_back(Args&&... args) { return emplace(_size, std::forward<Args>(args)...); }
+    void reserve(int c) { if (c > _capacity) reallocate(c); } // 预留容量，避免反复扩容
+    void sort(Rank lo, Rank hi, SortPolicy policy = SORT_INTRO); // 对区间 [lo, hi) 排序
+    void sort(SortPolicy policy = SORT_INTRO) { sort(0, _size, policy); } // 整体排序
+    void unsort(Rank lo, Rank hi) { unsort(lo, hi, threadRng()); } // 将区间 [lo, hi) 随机置乱
     void unsort() { unsort(0, _size); }
-    int  deduplicate();                 // 无序去重
+    template <typename Rng>
+    void unsort(Rank lo, Rank hi, Rng& rng); // 指定发生器（须提供 uniform(n)），同一种子得到同一排列
+    int  deduplicate()                  // 无序去重，保留首次出现者
+    { return deduplicate(typename HasStdHash<T>::type()); }
+    template <typename Hash, typename Eq>
+    int  deduplicate(Hash hash, Eq eq); // 散列去重，指定散列与判等函数对象
     int  uniquify();                    // 有序去重
 
     /* 遍历 */
     void traverse(void (*)(T&));        // 函数指针遍历
     template <typename VST>
     void traverse(VST&);                // 函数对象遍历
+
+    /* 排序算法接口 */
+    void bubbleSort(Rank lo, Rank hi);  // 起泡排序
+    void selectionSort(Rank lo, Rank hi);// 选择排序
+    void insertionSort(Rank lo, Rank hi);// 插入排序
+    void mergeSort(Rank lo, Rank hi);   // 归并排序
+    void quickSort(Rank lo, Rank hi);   // 快速排序
+    void heapSort(Rank lo, Rank hi);    // 堆排序
+    void introSort(Rank lo, Rank hi);   // 内省排序
+    template <typename KeyFn>
+    void radixSort(Rank lo, Rank hi, KeyFn key, bool descending = false); // 按 key(e) 做 LSD 基数排序（稳定）
+
+    /* 选取与部分排序：lt 为“小于”比较器，缺省为 operator< */
+    T& select(Rank k) { return select(0, _size, k); } // 秩为 k 者就位，前不大于、后不小于它
+    T& select(Rank lo, Rank hi, Rank k) { return select(lo, hi, k, std::less<T>()); } // lo <= k < hi
+    template <typename Cmp>
+    T& select(Rank lo, Rank hi, Rank k, Cmp lt);
+    void partialSort(Rank lo, Rank hi, Rank k) { partialSort(lo, hi, k, std::less<T>()); } // 最小的 k 个有序置于 [lo, lo + k)
+    template <typename Cmp>
+    void partialSort(Rank lo, Rank hi, Rank k, Cmp lt);
+    template <typename Cmp>
+    Vector<T> topK(Rank k, Cmp lt) const; // 按 lt 次序最靠前的 k 个，依次排列（向量本身不变）
+
+    /* 获取内部指针 */
+    T* data() const { return _elem; }
+
+    /* 持久化：写出文件头与元素的原始字节（仅限可平凡复制的 T），可由 MappedVector 直接映射 */
+    bool saveTo(const char* path) const;
 };
 
 /* =====================  实现部分  ===================== */
 
+template <typename T>
+T* Vector<T>::allocate(int c) {
+    size_t bytes = sizeof(T) * (c < 1 ? 1 : c);
+    T* p = static_cast<T*>(std::malloc(bytes));
+    if (!p) throw std::bad_alloc();
+    OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, bytes);
+    return p;
+}
+
+template <typename T>
+void Vector<T>::reallocate(int c, std::true_type) { // 可平凡复制：交由 realloc 原地扩展或整体搬迁
+    size_t bytes = sizeof(T) * (c < 1 ? 1 : c);
+    T* p = static_cast<T*>(std::realloc(static_cast<void*>(_elem), bytes));
+    if (!p) throw std::bad_alloc();
+    OPSTATS_ADD(allocs, 1); OPSTATS_ADD(bytes, bytes);
+    _elem = p; _capacity = c;
+}
+
+template <typename T>
+void Vector<T>::reallocate(int c, std::false_type) { // 一般类型：移动构造至新空间后析构旧元素
+    T* p = allocate(c);
+    for (Rank i = 0; i < _size; ++i) {
+        new (p + i) T(std::move_if_noexcept(_elem[i]));
+        _elem[i].~T();
+    }
+    deallocate(_elem);
+    _elem = p; _capacity = c;
+}
+
 template <typename T>
 void Vector<T>::copyFrom(T const* A, Rank lo, Rank hi) {
-    _elem = new T[_capacity = 2 * (hi - lo)];
-    _size = 0;
-    while (lo < hi) _elem[_size++] = A[lo++];
+    _elem = allocate(_capacity = 2 * (hi - lo));
+    construct(_elem, A + lo, _size = hi - lo, Trivial());
 }
 
 template <typename T>
 Vector<T>& Vector<T>::operator=(Vector<T> const& V) {
-    if (_elem) delete[] _elem;
-    copyFrom(V._elem, 0, V.size());
+    if (this == &V) return *this;
+    destroy(0, _size); _size = 0;
+    if (_capacity < V._size) { deallocate(_elem); _elem = allocate(_capacity = 2 * V._size); }
+    construct(_elem, V._elem, _size = V._size, Trivial());
+    return *this;
+}
+
+template <typename T>
+Vector<T>& Vector<T>::operator=(Vector<T>&& V) {
+    if (this == &V) return *this;
+    destroy(0, _size); deallocate(_elem);
+    _elem = V._elem; _size = V._size; _capacity = V._capacity;
+    V._elem = NULL; V._size = V._capacity = 0;
     return *this;
 }
 
@@ -87,39 +235,31 @@ template <typename T>
 void Vector<T>::expand() {
     if (_size < _capacity) return;
     if (_capacity < DEFAULT_CAPACITY) _capacity = DEFAULT_CAPACITY;
-    T* oldElem = _elem;
-    _elem = new T[_capacity <<= 1];
-    for (int i = 0; i < _size; ++i) _elem[i] = oldElem[i];
-    delete[] oldElem;
+    reallocate(_capacity << 1);
 }
 
 template <typename T>
 void Vector<T>::shrink() {
     if (_capacity < (DEFAULT_CAPACITY << 1)) return; // 不低于 2*DEFAULT_CAPACITY
     if (_size << 2 > _capacity) return;              // 25% 阈值
-    T* oldElem = _elem;
-    _elem = new T[_capacity >>= 1];
-    for (int i = 0; i < _size; ++i) _elem[i] = oldElem[i];
-    delete[] oldElem;
-}
-
-template <typename T>
-T& Vector<T>::operator[](Rank r) const {
-    return _elem[r];   // 断言: 0 <= r < _size
+    reallocate(_capacity >> 1);
 }
 
-/* 随机置乱算法 */
-template <typename T>
-void permute(Vector<T>& V) {
+/* 随机置乱算法（Fisher-Yates） */
+template <typename T, typename Rng>
+void permute(Vector<T>& V, Rng& rng) {
     for (int i = V.size(); i > 0; --i)
-        swap(V[i - 1], V[rand() % i]);
+        countedSwap(V[i - 1], V[rng.uniform(i)]);
 }
 
 template <typename T>
-void Vector<T>::unsort(Rank lo, Rank hi) {
+void permute(Vector<T>& V) { permute(V, threadRng()); }
+
+template <typename T> template <typename Rng>
+void Vector<T>::unsort(Rank lo, Rank hi, Rng& rng) {
     T* V = _elem + lo;
     for (Rank i = hi - lo; i > 0; --i)
-        swap(V[i - 1], V[rand() % i]);
+        countedSwap(V[i - 1], V[rng.uniform(i)]);
 }
 
 /* 比较器 */
@@ -131,16 +271,27 @@ void Vector<T>::unsort(Rank lo, Rank hi) {
 /* 无序查找：返回最后一个命中元素的秩；失败返回 lo-1 */
 template <typename T>
 Rank Vector<T>::find(T const& e, Rank lo, Rank hi) const {
-    while ((lo < hi--) && (e != _elem[hi])) ;
-    return hi;
+    return scanFind(_elem, e, lo, hi); // int、float、double 按块比对
 }
 
-/* 插入 */
+/* 插入：在秩 r 处就地构造，后继元素整体后移 */
 template <typename T>
-Rank Vector<T>::insert(Rank r, T const& e) {
+template <typename... Args>
+Rank Vector<T>::emplace(Rank r, Args&&... args) {
+    if (r == _size && _size < _capacity) { // 尾部且无需扩容：直接在末尾构造
+        new (_elem + _size) T(std::forward<Args>(args)...);
+        ++_size; return r;
+    }
+    T x(std::forward<Args>(args)...); // 先行构造，以防参数引用本向量中即将搬迁的元素
     expand();
-    for (int i = _size; i > r; --i) _elem[i] = _elem[i - 1];
-    _elem[r] = e; ++_size;
+    if (r == _size) {
+        new (_elem + _size) T(std::move(x));
+    } else {
+        new (_elem + _size) T(std::move(_elem[_size - 1]));
+        std::move_backward(_elem + r, _elem + _size - 1, _elem + _size);
+        _elem[r] = std::move(x);
+    }
+    ++_size;
     return r;
 }
 
@@ -148,8 +299,9 @@ Rank Vector<T>::insert(Rank r, T const& e) {
 template <typename T>
 int Vector<T>::remove(Rank lo, Rank hi) {
     if (lo == hi) return 0;
-    while (hi < _size) _elem[lo++] = _elem[hi++];
-    _size = lo;
+    std::move(_elem + hi, _elem + _size, _elem + lo);
+    destroy(_size - (hi - lo), _size);
+    _size -= hi - lo;
     shrink();
     return hi - lo;   // 返回被删元素个数
 }
@@ -157,28 +309,53 @@ int Vector<T>::remove(Rank lo, Rank hi) {
 /* 删除秩为 r 的单个元素 */
 template <typename T>
 T Vector<T>::remove(Rank r) {
-    T e = _elem[r];
+    T e = std::move(_elem[r]);
     remove(r, r + 1);
     return e;
 }
 
-/* 无序去重 */
+/* 无序去重（散列）：一趟扫描，首次出现者依次前移至 [0, k)，散列表登记其新位置；
+   重复者只被覆盖，不逐个删除，故 O(n) */
+template <typename T> template <typename Hash, typename Eq>
+int Vector<T>::deduplicate(Hash hash, Eq eq) {
+    if (_size < 2) return 0;
+    DedupTable<T, Hash, Eq> seen(_size, hash, eq);
+    Rank k = 0;
+    for (Rank i = 0; i < _size; ++i) {
+        if (k < i) _elem[k] = std::move(_elem[i]); // _elem[k] 或已移走，或为重复者，可覆盖
+        if (seen.insert(_elem[k])) ++k;
+    }
+    int removed = _size - k;
+    destroy(k, _size); _size = k;
+    shrink();
+    return removed;
+}
+
+/* 无序去重（逐一比对）：仅在已保留的前缀 [0, k) 中查找雷同者，同样一趟压缩，O(n^2) 次比较 */
 template <typename T>
-int Vector<T>::deduplicate() {
-    int oldSize = _size;
-    Rank i = 1;
-    while (i < _size)
-        (find(_elem[i], 0, i) < 0) ? ++i : remove(i);
-    return oldSize - _size;
+int Vector<T>::deduplicate(std::false_type) {
+    if (_size < 2) return 0;
+    Rank k = 1;
+    for (Rank i = 1; i < _size; ++i)
+        if (find(_elem[i], 0, k) < 0) {
+            if (k < i) _elem[k] = std::move(_elem[i]);
+            ++k;
+        }
+    int removed = _size - k;
+    destroy(k, _size); _size = k;
+    shrink();
+    return removed;
 }
 
 /* 有序去重 */
 template <typename T>
 int Vector<T>::uniquify() {
+    if (_size < 2) return 0;
     Rank i = 0, j = 0;
     while (++j < _size)
-        if (_elem[i] != _elem[j]) _elem[++i] = _elem[j];
-    _size = ++i;
+        if (!(_elem[i] == _elem[j]) && ++i != j) _elem[i] = std::move(_elem[j]); // 尚无重复时 i == j，不可自移动
+    destroy(++i, _size);
+    _size = i;
     shrink();
     return j - i;
 }
@@ -198,10 +375,7 @@ void Vector<T>::traverse(VST& visit) {
 /* 判断有序性：返回逆序对总数 */
 template <typename T>
 int Vector<T>::disordered() const {
-    int n = 0;
-    for (int i = 1; i < _size; ++i)
-        if (_elem[i - 1] > _elem[i]) ++n;
-    return n;
+    return scanDisordered(_elem, _size);
 }
 
 /* 递增函数对象 */
@@ -215,15 +389,9 @@ void increase(Vector<T>& V) {
     V.traverse(Increase<T>());
 }
 
-/* 有序查找：二分 / Fibonacci 随机选择 */
-template <typename T>
-Rank Vector<T>::search(T const& e, Rank lo, Rank hi) const {
-    return (rand() % 2) ? binSearch(_elem, e, lo, hi) : fibSearch(_elem, e, lo, hi);
-}
-
 /* 二分查找（版本 C） */
 template <typename T>
-static Rank binSearch(T* A, T const& e, Rank lo, Rank hi) {
+static Rank binSearch(T const* A, T const& e, Rank lo, Rank hi) {
     while (lo < hi) {
         Rank mi = (lo + hi) >> 1;
         (e < A[mi]) ? hi = mi : lo = mi + 1;
@@ -231,15 +399,28 @@ static Rank binSearch(T* A, T const& e, Rank lo, Rank hi) {
     return --lo;   // 返回不大于 e 的最大秩
 }
 
-/* 排序主入口：随机选用 5 种算法之一 */
+/*  Fibonacci 查找仅声明，未给出实现
+    template <typename T>
+    static Rank fibSearch(T* A, T const& e, Rank lo, Rank hi);
+*/
+
+/* 有序查找；同一向量上的大量查询可改用 SortedIndex.h 建立静态索引 */
 template <typename T>
-void Vector<T>::sort(Rank lo, Rank hi) {
-    switch (rand() % 5) {
-        case 1: bubbleSort(lo, hi); break;
-        case 2: selectionSort(lo, hi); break;
-        case 3: mergeSort(lo, hi); break;
-        case 4: heapSort(lo, hi); break;
-        default: quickSort(lo, hi); break;
+Rank Vector<T>::search(T const& e, Rank lo, Rank hi) const {
+    return binSearch(_elem, e, lo, hi);
+}
+
+/* 排序主入口：按策略选用算法，默认内省排序 */
+template <typename T>
+void Vector<T>::sort(Rank lo, Rank hi, SortPolicy policy) {
+    switch (policy) {
+        case SORT_BUBBLE: bubbleSort(lo, hi); break;
+        case SORT_SELECTION: selectionSort(lo, hi); break;
+        case SORT_INSERTION: insertionSort(lo, hi); break;
+        case SORT_MERGE: mergeSort(lo, hi); break;
+        case SORT_HEAP: heapSort(lo, hi); break;
+        case SORT_QUICK: quickSort(lo, hi); break;
+        default: introSort(lo, hi); break;
     }
 }
 
@@ -253,36 +434,43 @@ template <typename T>
 bool Vector<T>::bubble(Rank lo, Rank hi) {
     bool sorted = true;
     while (++lo < hi)
-        if (_elem[lo - 1] > _elem[lo]) {
+        if (_elem[lo] < _elem[lo - 1]) {
             sorted = false;
-            swap(_elem[lo - 1], _elem[lo]);
+            countedSwap(_elem[lo - 1], _elem[lo]);
         }
     return sorted;
 }
 
-/* 归并排序 */
+/* 归并排序：整趟排序只申请一块可容纳左半段的缓冲区 */
 template <typename T>
 void Vector<T>::mergeSort(Rank lo, Rank hi) {
+    if (hi - lo < 2) return;
+    T* B = allocate((hi - lo + 1) >> 1);
+    mergeSort(lo, hi, B);
+    deallocate(B);
+}
+
+template <typename T>
+void Vector<T>::mergeSort(Rank lo, Rank hi, T* B) {
     if (hi - lo < 2) return;
     Rank mi = (lo + hi) >> 1;
-    mergeSort(lo, mi);
-    mergeSort(mi, hi);
-    merge(lo, mi, hi);
+    mergeSort(lo, mi, B);
+    mergeSort(mi, hi, B);
+    merge(lo, mi, hi, B);
 }
 
 template <typename T>
-void Vector<T>::merge(Rank lo, Rank mi, Rank hi) {
+void Vector<T>::merge(Rank lo, Rank mi, Rank hi, T* B) {
     T* A = _elem + lo;
     int lb = mi - lo;
-    T* B = new T[lb];
-    for (Rank i = 0; i < lb; ++i) B[i] = A[i];
+    for (Rank i = 0; i < lb; ++i) new (B + i) T(std::move(A[i])); // 左半段移入缓冲区
     int lc = hi - mi;
     T* C = _elem + mi;
-    for (Rank i = 0, j = 0, k = 0; (j < lb) || (k < lc); ) {
-        if ((j < lb) && (!(k < lc) || (B[j] <= C[k]))) A[i++] = B[j++];
-        if ((k < lc) && (!(j < lb) || (C[k] <  B[j]))) A[i++] = C[k++];
-    }
-    delete[] B;
+    Rank i = 0, j = 0, k = 0;
+    while ((j < lb) && (k < lc)) // 相等时左侧优先，保证稳定
+        A[i++] = (C[k] < B[j]) ? std::move(C[k++]) : std::move(B[j++]);
+    while (j < lb) A[i++] = std::move(B[j++]); // 右半段剩余元素已在原位
+    for (Rank t = 0; t < lb; ++t) B[t].~T();
 }
 
 /* 选择排序 */
@@ -292,7 +480,19 @@ void Vector<T>::selectionSort(Rank lo, Rank hi) {
         Rank minIndex = i;
         for (Rank j = i + 1; j < hi; ++j)
             if (_elem[j] < _elem[minIndex]) minIndex = j;
-        if (minIndex != i) swap(_elem[i], _elem[minIndex]);
+        if (minIndex != i) countedSwap(_elem[i], _elem[minIndex]);
+    }
+}
+
+/* 插入排序：逐个将元素后移插入前缀有序区间 */
+template <typename T>
+void Vector<T>::insertionSort(Rank lo, Rank hi) {
+    for (Rank i = lo + 1; i < hi; ++i) {
+        if (!(_elem[i] < _elem[i - 1])) continue;
+        T e = std::move(_elem[i]);
+        Rank j = i;
+        do { _elem[j] = std::move(_elem[j - 1]); } while (lo < --j && e < _elem[j - 1]);
+        _elem[j] = std::move(e);
     }
 }
 
@@ -310,19 +510,260 @@ Rank Vector<T>::partition(Rank lo, Rank hi) {
     T pivot = _elem[lo];
     Rank i = lo, j = hi - 1;
     while (i < j) {
-        while (i < j && _elem[j] >= pivot) --j;
+        while (i < j && !(_elem[j] < pivot)) --j;
         _elem[i] = _elem[j];
-        while (i < j && _elem[i] <= pivot) ++i;
+        while (i < j && !(pivot < _elem[i])) ++i;
         _elem[j] = _elem[i];
     }
     _elem[i] = pivot;
     return i;
 }
 
-/* 堆排序（此处用选择排序占位） */
+/* 完全二叉堆的下滤：在堆 A[0, n) 中将 A[i] 下移至合适位置，lt 为“小于”比较器（大顶堆） */
+template <typename T, typename Cmp>
+Rank percolateDown(T* A, Rank n, Rank i, Cmp lt) {
+    T e = std::move(A[i]);
+    for (Rank j; (j = 2 * i + 1) < n; i = j) { // 逐层选出更大的孩子
+        if (j + 1 < n && lt(A[j], A[j + 1])) ++j;
+        if (!lt(e, A[j])) break;
+        A[i] = std::move(A[j]);
+    }
+    A[i] = std::move(e);
+    return i;
+}
+
+/* Floyd 建堆：自底而上逐个下滤内部节点，O(n) */
+template <typename T, typename Cmp>
+void heapify(T* A, Rank n, Cmp lt) {
+    for (Rank i = n / 2 - 1; 0 <= i; --i) percolateDown(A, n, i, lt);
+}
+
+/* 堆排序：就地建堆，再反复将堆顶交换至末尾 */
+template <typename T, typename Cmp>
+void heapSortBy(T* A, Rank n, Cmp lt) {
+    heapify(A, n, lt);
+    while (1 < n) {
+        countedSwap(A[0], A[--n]);
+        percolateDown(A, n, 0, lt);
+    }
+}
+
 template <typename T>
 void Vector<T>::heapSort(Rank lo, Rank hi) {
-    selectionSort(lo, hi);
+    heapSortBy(_elem + lo, hi - lo, std::less<T>());
+}
+
+/* 按 lt 对 A[lo, hi) 插入排序，供选取算法处理小区间 */
+template <typename T, typename Cmp>
+void insertionSortBy(T* A, Rank lo, Rank hi, Cmp lt) {
+    for (Rank i = lo + 1; i < hi; ++i) {
+        if (!lt(A[i], A[i - 1])) continue;
+        T e = std::move(A[i]);
+        Rank j = i;
+        do { A[j] = std::move(A[j - 1]); } while (lo < --j && lt(e, A[j - 1]));
+        A[j] = std::move(e);
+    }
+}
+
+/* 三路划分（Dijkstra）：以 A[p] 为枢轴划分 A[lo, hi)，
+   返回后 [lo, eqLo) < 枢轴，[eqLo, eqHi) 与之相等，[eqHi, hi) > 枢轴 */
+template <typename T, typename Cmp>
+void partition3(T* A, Rank lo, Rank hi, Rank p, Cmp lt, Rank& eqLo, Rank& eqHi) {
+    countedSwap(A[lo], A[p]);
+    T pivot = A[lo];
+    Rank l = lo, i = lo + 1, g = hi;
+    while (i < g) {
+        if (lt(A[i], pivot)) countedSwap(A[l++], A[i++]);
+        else if (lt(pivot, A[i])) countedSwap(A[i], A[--g]);
+        else ++i;
+    }
+    eqLo = l; eqHi = g;
+}
+
+template <typename T, typename Cmp>
+void introSelect(T* A, Rank lo, Rank hi, Rank k, Cmp lt);
+
+/* 中位数之中位数（BFPRT）：五个一组取中位数，集中于区间前部后递归选出其中位数并返回其秩；
+   以之为枢轴，两侧各至少含约 3/10 的元素 */
+template <typename T, typename Cmp>
+Rank medianOfMedians(T* A, Rank lo, Rank hi, Cmp lt) {
+    Rank m = lo;
+    for (Rank g = lo; g < hi; g += 5) {
+        Rank e = (g + 5 < hi) ? g + 5 : hi;
+        insertionSortBy(A, g, e, lt);
+        countedSwap(A[m++], A[g + (e - g) / 2]);
+    }
+    Rank mid = lo + (m - lo) / 2;
+    introSelect(A, lo, m, mid, lt);
+    return mid;
+}
+
+/* 内省选取：令 A[k] 就位，且 A[lo, k) 均不大于、A(k, hi) 均不小于它
+   - 通常以三数取中为枢轴，三路划分后只在 k 所在一侧继续，期望 O(n)；等值元素一次归拢
+   - 每两趟检查一次区间是否至少缩小一半，否则此后改用中位数之中位数选取枢轴，
+     此前各趟耗时构成几何级数，故最坏情况亦为 O(n) */
+template <typename T, typename Cmp>
+void introSelect(T* A, Rank lo, Rank hi, Rank k, Cmp lt) {
+    Rank checkpoint = hi - lo;
+    bool guaranteed = false;
+    for (int round = 1; INSERTION_SORT_THRESHOLD < hi - lo; ++round) {
+        if (!guaranteed && !(round & 1)) {
+            if (checkpoint / 2 < hi - lo) guaranteed = true;
+            checkpoint = hi - lo;
+        }
+        Rank p;
+        if (guaranteed) p = medianOfMedians(A, lo, hi, lt);
+        else {
+            Rank a = lo, b = lo + (hi - lo) / 2, c = hi - 1;
+            if (lt(A[a], A[b])) p = lt(A[b], A[c]) ? b : (lt(A[a], A[c]) ? c : a);
+            else p = lt(A[a], A[c]) ? a : (lt(A[b], A[c]) ? c : b);
+        }
+        Rank eqLo, eqHi;
+        partition3(A, lo, hi, p, lt, eqLo, eqHi);
+        if (k < eqLo) hi = eqLo;
+        else if (eqHi <= k) lo = eqHi;
+        else return;
+    }
+    insertionSortBy(A, lo, hi, lt);
+}
+
+/* 内省排序：递归深度上限取 2*log2(n) */
+template <typename T>
+void Vector<T>::introSort(Rank lo, Rank hi) {
+    int depth = 0;
+    for (Rank n = hi - lo; n > 1; n >>= 1) depth += 2;
+    introSort(lo, hi, depth, true);
+}
+
+template <typename T>
+Rank Vector<T>::medianOf3(Rank a, Rank b, Rank c) const {
+    if (_elem[a] < _elem[b])
+        return (_elem[b] < _elem[c]) ? b : ((_elem[a] < _elem[c]) ? c : a);
+    return (_elem[a] < _elem[c]) ? a : ((_elem[b] < _elem[c]) ? c : b);
+}
+
+template <typename T>
+Rank Vector<T>::choosePivot(Rank lo, Rank hi) const {
+    Rank n = hi - lo, mi = lo + (n >> 1), last = hi - 1;
+    if (n < 128) return medianOf3(lo, mi, last);
+    Rank d = n >> 3; // Tukey 九数取中
+    return medianOf3(medianOf3(lo, lo + d, lo + 2 * d),
+                     medianOf3(mi - d, mi, mi + d),
+                     medianOf3(last - 2 * d, last - d, last));
+}
+
+/* 非最左区间的左邻元素不大于区间内任何元素；若枢轴与之相等，则区间内不存在小于枢轴者，
+   此时将所有等于枢轴的元素一次归拢至左端并跳过，从而三路划分大量重复元素 */
+template <typename T>
+void Vector<T>::introSort(Rank lo, Rank hi, int depth, bool leftmost) {
+    while (INSERTION_SORT_THRESHOLD < hi - lo) {
+        if (depth-- <= 0) { heapSort(lo, hi); return; } // 划分持续失衡，改用堆排序保证 O(nlogn)
+        countedSwap(_elem[lo], _elem[choosePivot(lo, hi)]);
+        if (!leftmost && !(_elem[lo - 1] < _elem[lo])) { // 枢轴等于左邻：归拢等值元素
+            Rank k = lo + 1;
+            for (Rank i = lo + 1; i < hi; ++i)
+                if (!(_elem[lo] < _elem[i])) countedSwap(_elem[k++], _elem[i]);
+            lo = k; continue;
+        }
+        T pivot = std::move(_elem[lo]); // Hoare 划分：[lo, p) < pivot <= [p + 1, hi)
+        Rank i = lo, j = hi;
+        while (++i < j && _elem[i] < pivot) ;
+        while (i < --j && !(_elem[j] < pivot)) ;
+        while (i < j) { // 此后两侧均有哨兵，无需边界检查
+            countedSwap(_elem[i], _elem[j]);
+            while (_elem[++i] < pivot) ;
+            while (!(_elem[--j] < pivot)) ;
+        }
+        Rank p = i - 1;
+        _elem[lo] = std::move(_elem[p]); _elem[p] = std::move(pivot);
+        if (p - lo < hi - p) { introSort(lo, p, depth, leftmost); lo = p + 1; leftmost = false; } // 递归处理较短一侧
+        else { introSort(p + 1, hi, depth, false); hi = p; }
+    }
+    insertionSort(lo, hi);
+}
+
+template <typename T> template <typename Cmp>
+T& Vector<T>::select(Rank lo, Rank hi, Rank k, Cmp lt) {
+    introSelect(_elem, lo, hi, k, lt);
+    return _elem[k];
+}
+
+/* 部分排序：先选出第 k 小者，再对其前的 k - 1 个元素堆排序，O(n + klogk) */
+template <typename T> template <typename Cmp>
+void Vector<T>::partialSort(Rank lo, Rank hi, Rank k, Cmp lt) {
+    if (hi - lo < k) k = hi - lo;
+    if (k < 1) return;
+    if (lo + k < hi) { introSelect(_elem, lo, hi, lo + k - 1, lt); heapSortBy(_elem + lo, k - 1, lt); }
+    else heapSortBy(_elem + lo, k, lt); // 取全部元素，即整体排序
+}
+
+template <typename T> template <typename Cmp>
+Vector<T> Vector<T>::topK(Rank k, Cmp lt) const {
+    Vector<T> R(*this);
+    if (k < 0) k = 0;
+    if (_size < k) k = _size;
+    R.partialSort(0, _size, k, lt);
+    R.remove(k, _size);
+    return R;
+}
+
+/* LSD 基数排序：按字节逐趟分配，关键码仅提取、编码一次；
+   所有字节的直方图在同一趟扫描中求得，若某字节上所有关键码相同则跳过该趟 */
+template <typename T>
+template <typename KeyFn>
+void Vector<T>::radixSort(Rank lo, Rank hi, KeyFn key, bool descending) {
+    typedef typename std::decay<decltype(key(_elem[lo]))>::type K;
+    typedef typename RadixKey<K>::type U;
+    const int PASSES = sizeof(U);
+    Rank n = hi - lo;
+    if (n < 2) return;
+    U* keys = static_cast<U*>(std::malloc(sizeof(U) * n * 2)); // 关键码与元素同步交替搬迁
+    T* buf = allocate(n);
+    if (!keys) { deallocate(buf); throw std::bad_alloc(); }
+    Rank (*count)[256] = new Rank[PASSES][256]();
+    OPSTATS_ADD(allocs, 2); OPSTATS_ADD(bytes, sizeof(U) * n * 2 + sizeof(Rank) * PASSES * 256);
+    for (Rank i = 0; i < n; ++i) {
+        U u = RadixKey<K>::encode(key(_elem[lo + i]));
+        if (descending) u = ~u;
+        keys[i] = u;
+        for (int p = 0; p < PASSES; ++p) ++count[p][(u >> (p * 8)) & 0xFF];
+        new (buf + i) T(std::move(_elem[lo + i]));
+    }
+    T* src = buf; T* dst = _elem + lo;
+    U* srcKey = keys; U* dstKey = keys + n;
+    for (int p = 0; p < PASSES; ++p) {
+        int shift = p * 8;
+        if (count[p][(srcKey[0] >> shift) & 0xFF] == n) continue; // 本字节无区分度
+        Rank offset[256];
+        for (int d = 0, sum = 0; d < 256; ++d) { offset[d] = sum; sum += count[p][d]; }
+        for (Rank i = 0; i < n; ++i) {
+            Rank pos = offset[(srcKey[i] >> shift) & 0xFF]++;
+            dstKey[pos] = srcKey[i];
+            dst[pos] = std::move(src[i]);
+        }
+        std::swap(src, dst); std::swap(srcKey, dstKey);
+    }
+    if (src == buf) std::move(buf, buf + n, _elem + lo); // 结果仍在缓冲区，移回原位
+    for (Rank i = 0; i < n; ++i) buf[i].~T();
+    deallocate(buf); std::free(keys); delete[] count;
+}
+
+/* 持久化：失败（无法打开或写入不完整）时返回 false */
+template <typename T>
+bool Vector<T>::saveTo(const char* path) const {
+    static_assert(std::is_trivially_copyable<T>::value, "saveTo requires a trivially copyable element type");
+    VectorFileHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, VECTOR_FILE_MAGIC, sizeof(h.magic));
+    h.version = VECTOR_FILE_VERSION;
+    h.elemSize = sizeof(T);
+    h.count = (uint64_t) _size;
+    h.checksum = vectorChecksum(_elem, sizeof(T) * _size);
+    FILE* fp = fopen(path, "wb");
+    if (!fp) return false;
+    bool ok = fwrite(&h, sizeof(h), 1, fp) == 1
+           && (_size == 0 || fwrite(_elem, sizeof(T), _size, fp) == (size_t) _size);
+    return (fclose(fp) == 0) && ok;
 }
 
 /* 全局 swap */
@@ -331,9 +772,4 @@ void swap(T& a, T& b) {
     T temp = a; a = b; b = temp;
 }
 
-/*  Fibonacci 查找仅声明，未给出实现，留空即可
-    template <typename T>
-    static Rank fibSearch(T* A, T const& e, Rank lo, Rank hi);
-*/
-
-#endif // MYLIBRARY_VECTOR_H
\ No newline at end of file
+#endif // MYLIBRARY_VECTOR_H
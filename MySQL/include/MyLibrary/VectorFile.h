@@ -0,0 +1,39 @@
+#ifndef MYLIBRARY_VECTORFILE_H
+#define MYLIBRARY_VECTORFILE_H
+
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+/* 向量文件格式：64 字节文件头 + 元素的原始字节（按缓存行对齐），
+   由 Vector::saveTo 写出、MappedVector 映射读取；按本机字节序与结构布局存放 */
+#define VECTOR_FILE_MAGIC "DSVECTOR"
+#define VECTOR_FILE_VERSION 1
+
+struct VectorFileHeader {
+    char magic[8];          // VECTOR_FILE_MAGIC（不含结尾 '\0'）
+    uint32_t version;       // 格式版本
+    uint32_t elemSize;      // sizeof(T)
+    uint64_t count;         // 元素数
+    uint64_t checksum;      // 数据区校验和
+    char reserved[32];      // 补齐至 64 字节
+};
+
+static_assert(sizeof(VectorFileHeader) == 64, "VectorFileHeader must be 64 bytes");
+
+/* 数据区校验和：按 8 字节字做乘法散列，尾部逐字节，约数 GB/s */
+inline uint64_t vectorChecksum(void const* data, size_t n) {
+    const unsigned char* b = static_cast<const unsigned char*>(data);
+    uint64_t h = 0xcbf29ce484222325ULL ^ n;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, b + i, 8);
+        h = (h ^ w) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    for (; i < n; ++i) h = (h ^ b[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+#endif // MYLIBRARY_VECTORFILE_H
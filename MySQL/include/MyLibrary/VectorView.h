@@ -0,0 +1,55 @@
+#ifndef MYLIBRARY_VECTORVIEW_H
+#define MYLIBRARY_VECTORVIEW_H
+
+#include "Vector.h"
+#include <type_traits>
+
+/* 向量视图：不持有元素，只指向某个向量的区间 [lo, hi)
+   - 查找、排序等直接转交所属向量的区间版本完成，秩按视图内的相对位置换算，不复制任何元素
+   - VectorView<T const> 为只读视图，可取自 const 向量；只读视图上调用排序等修改操作无法通过编译
+   - 所属向量插入、删除或扩容之后，视图随即失效 */
+template <typename T>
+class VectorView {
+private:
+    typedef typename std::remove_const<T>::type E; // 元素类型
+    typedef typename std::conditional<std::is_const<T>::value, Vector<E> const, Vector<E> >::type Owner;
+
+    Owner* _v;      // 所属向量
+    Rank _lo, _hi;  // 在所属向量中的区间
+
+public:
+    VectorView(Owner& V) : _v(&V), _lo(0), _hi(V.size()) {}
+    VectorView(Owner& V, Rank lo, Rank hi) : _v(&V), _lo(lo), _hi(hi) {}
+    operator VectorView<E const>() const { return VectorView<E const>(*_v, _lo, _hi); } // 可写视图转为只读视图
+
+    /* 只读访问接口 */
+    Rank size() const { return _hi - _lo; }
+    bool empty() const { return _hi <= _lo; }
+    Rank offset() const { return _lo; } // 视图起点在所属向量中的秩
+    T* data() const { return _v->data() + _lo; }
+    T& operator[](Rank r) const { return data()[r]; }
+    VectorView subview(Rank lo, Rank hi) const { return VectorView(*_v, _lo + lo, _lo + hi); }
+    int disordered() const { return scanDisordered(data(), size()); } // 相邻逆序对数
+    Rank find(T const& e) const { return find(e, 0, size()); }
+    Rank find(T const& e, Rank lo, Rank hi) const // 无序区间查找：失败返回 lo - 1
+    { return _v->find(e, _lo + lo, _lo + hi) - _lo; }
+    Rank search(T const& e) const { return search(e, 0, size()); }
+    Rank search(T const& e, Rank lo, Rank hi) const // 有序区间查找：返回不大于 e 的最大秩
+    { return _v->search(e, _lo + lo, _lo + hi) - _lo; }
+
+    /* 遍历 */
+    void traverse(void (*visit)(T&)) const { for (Rank i = _lo; i < _hi; ++i) visit((*_v)[i]); }
+    template <typename VST>
+    void traverse(VST& visit) const { for (Rank i = _lo; i < _hi; ++i) visit((*_v)[i]); }
+
+    /* 就地修改所属向量的区间 */
+    void sort(SortPolicy policy = SORT_INTRO) const { _v->sort(_lo, _hi, policy); }
+    void sort(Rank lo, Rank hi, SortPolicy policy = SORT_INTRO) const { _v->sort(_lo + lo, _lo + hi, policy); }
+    template <typename KeyFn>
+    void radixSort(KeyFn key, bool descending = false) const { _v->radixSort(_lo, _hi, key, descending); }
+    void unsort() const { _v->unsort(_lo, _hi); }
+    T& select(Rank k) const { return _v->select(_lo, _hi, _lo + k); }
+    void partialSort(Rank k) const { _v->partialSort(_lo, _hi, k); }
+};
+
+#endif // MYLIBRARY_VECTORVIEW_H
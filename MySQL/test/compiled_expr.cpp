@@ -0,0 +1,32 @@
+// CompiledExpr 回归测试：阶乘对任意输入均有定义且立即返回（NaN 得 NaN，溢出得 inf，负数得 0），
+// 逐行求值与批量求值结果一致
+#include "MyLibrary/CompiledExpr.h"
+#include <cstdio>
+#include <cmath>
+#include <limits>
+
+int main() {
+    const float inf = std::numeric_limits<float>::infinity(), nan = std::numeric_limits<float>::quiet_NaN();
+    const float in[] = { nan, inf, -inf, 1e30f, -1e30f, 3e9f, -3e9f, 35.0f, 34.9f, 34.0f, 5.5f, 0.0f, -0.5f, -1.0f };
+    const int n = sizeof(in) / sizeof(in[0]);
+    const char* names[] = { "x" };
+    CompiledExpr e("x!", names, 1);
+    float out[n];
+    const float* columns[] = { in };
+    e.evaluate(columns, n, out);
+
+    int fail = 0;
+    for (int i = 0; i < n; i++) {
+        float x = in[i], r = e.evaluate(&x), expect;
+        if (x != x) expect = nan;
+        else if (35 <= x) expect = inf;
+        else if (x <= -1) expect = 0;
+        else { expect = 1; for (int k = 2; k <= (int) x; k++) expect *= k; }
+        bool same = (r == expect) || (r != r && expect != expect);
+        bool batch = (out[i] == r) || (out[i] != out[i] && r != r);
+        if (!same || !batch) { printf("FAILED: (%g)! = %g, batch %g, expected %g\n", x, r, out[i], expect); fail++; }
+    }
+    if (!std::isfinite(e.evaluate(&in[9]))) { printf("FAILED: 34! should be finite\n"); fail++; }
+    if (CompiledExpr("1e30!").evaluate() != inf) { printf("FAILED: constant folding\n"); fail++; }
+    return fail ? 1 : 0;
+}
@@ -0,0 +1,51 @@
+// CompiledExpr 回归测试：栈深不超过 EXPR_LOCAL_STACK（批量求值为 EXPR_LOCAL_BLOCKS）时，
+// 逐行与批量求值均不申请任何堆空间
+#define MYLIBRARY_STATS // 统计容器内部的 malloc
+#include "MyLibrary/CompiledExpr.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+static long long newCalls = 0; // operator new 的调用次数
+
+void* operator new(size_t n) { newCalls++; if (void* p = std::malloc(n ? n : 1)) return p; throw std::bad_alloc(); }
+void* operator new[](size_t n) { newCalls++; if (void* p = std::malloc(n ? n : 1)) return p; throw std::bad_alloc(); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+
+static long long allocations() { return newCalls + OpStats::get().allocs; }
+
+int main() {
+    int fail = 0;
+    const char* names[] = { "x", "y" };
+    CompiledExpr e("sqrt(x * x + y * y) * sin(x) + max(x, y) ^ 2 - 3!", names, 2);
+    float v[2] = { 1.5f, 2.5f }, sum = 0;
+
+    long long before = allocations();
+    for (int i = 0; i < 1000; i++) { v[0] += 0.001f; sum += e.evaluate(v); }
+    long long scalar = allocations() - before;
+    if (scalar) { printf("FAILED: %lld allocations in 1000 scalar evaluations\n", scalar); fail++; }
+
+    const int n = 3000; // 不是块长的整数倍
+    static float xs[n], ys[n], out[n];
+    for (int i = 0; i < n; i++) { xs[i] = i * 0.01f; ys[i] = 1 - i * 0.002f; }
+    const float* columns[] = { xs, ys };
+    before = allocations();
+    for (int r = 0; r < 100; r++) e.evaluate(columns, n, out);
+    long long batch = allocations() - before;
+    if (batch) { printf("FAILED: %lld allocations in 100 batch evaluations\n", batch); fail++; }
+
+    std::string deep; // 栈深超出 EXPR_LOCAL_STACK 时改用堆，结果不变
+    for (int i = 0; i < EXPR_LOCAL_STACK + 8; i++) deep += "x+(";
+    deep += "y";
+    for (int i = 0; i < EXPR_LOCAL_STACK + 8; i++) deep += ")";
+    CompiledExpr d(deep.c_str(), names, 2);
+    v[0] = 1; v[1] = 2; // 整数取值，求和无舍入
+    if (d.evaluate(v) != (EXPR_LOCAL_STACK + 8) * v[0] + v[1]) { printf("FAILED: deep expression\n"); fail++; }
+    float one[1] = { 1 }, two[1] = { 2 }, deepOut[1];
+    const float* deepColumns[] = { one, two };
+    d.evaluate(deepColumns, 1, deepOut);
+    if (deepOut[0] != d.evaluate(v)) { printf("FAILED: deep expression, batch\n"); fail++; }
+    return (fail || sum != sum) ? 1 : 0;
+}
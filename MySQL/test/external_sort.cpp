@@ -0,0 +1,31 @@
+// ExternalSort 回归测试：输入有误时 sort 须返回 false，而不是输出截断的结果
+//   - 输入文件末尾有残缺的记录
+//   - 输入无法读取（以目录代替文件，fread 出错；记录长度取 1，使长度检查无从发现）
+#include "MyLibrary/ExternalSort.h"
+#include <cstdio>
+#include <string>
+
+static bool writeFile(const char* path, const void* data, size_t bytes) {
+    FILE* fp = fopen(path, "wb");
+    if (!fp) return false;
+    bool ok = fwrite(data, 1, bytes, fp) == bytes;
+    return (fclose(fp) == 0) && ok;
+}
+
+int main() {
+    int fail = 0;
+    std::string in = "external_sort_test.in", out = "external_sort_test.out";
+    int A[1000];
+    for (int i = 0; i < 1000; i++) A[i] = (i * 7919) % 1000;
+
+    ExternalSort<int> sorter(1 << 12); // 多个归并段
+    if (!writeFile(in.c_str(), A, sizeof(A)) || !sorter.sort(in.c_str(), out.c_str())) { printf("FAILED: valid input\n"); fail++; }
+
+    if (!writeFile(in.c_str(), A, sizeof(A) - 1) || sorter.sort(in.c_str(), out.c_str())) { printf("FAILED: trailing partial record accepted\n"); fail++; }
+
+    ExternalSort<char> bytes(1 << 12);
+    if (bytes.sort(".", out.c_str())) { printf("FAILED: unreadable input accepted\n"); fail++; }
+
+    std::remove(in.c_str()); std::remove(out.c_str());
+    return fail ? 1 : 0;
+}
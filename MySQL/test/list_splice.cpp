@@ -0,0 +1,49 @@
+// List::splice / merge 回归测试：各自使用缺省节点池的两个列表之间转移节点，
+// 只调整链接，不复制元素、不申请节点；源列表先于目标列表销毁后，转入的节点仍然有效
+#include "MyLibrary/List.h"
+#include <cstdio>
+
+typedef Counted<int> Elem;
+
+static int check(bool ok, const char* what) {
+    if (!ok) printf("FAILED: %s\n", what);
+    return ok ? 0 : 1;
+}
+
+static bool equals(List<Elem> const& L, const int* v, int n) {
+    if (L.size() != n) return false;
+    ListNode<Elem>* p = L.first();
+    for (int i = 0; i < n; i++, p = p->succ) if (p->data.value() != v[i]) return false;
+    return true;
+}
+
+int main() {
+    int fail = 0;
+    List<Elem> A;
+    for (int i = 0; i < 8; i += 2) A.insertAsLast(Elem(i)); // 0 2 4 6
+    {
+        List<Elem> B, C;
+        for (int i = 1; i < 8; i += 2) B.insertAsLast(Elem(i)); // 1 3 5 7
+        for (int i = 10; i < 13; i++) C.insertAsLast(Elem(i)); // 10 11 12
+        fail += check(A.allocator() != B.allocator(), "default lists start with separate pools");
+
+        OpStats before = OpStats::get();
+        A.merge(B); // 0 1 2 3 4 5 6 7
+        A.splice(A.first(), C, C.last()); // 12 0 1 ... 7
+        A.splice(A.last(), C, C.first(), C.last()->succ); // 12 0 ... 6 10 11 7
+        OpStats d = OpStats::get() - before;
+        fail += check(d.copies == 0 && d.moves == 0, "no element copies or moves during cross-list splice/merge");
+        fail += check(B.empty() && C.empty(), "sources emptied");
+        fail += check(A.allocator() == B.allocator() && A.allocator() == C.allocator(), "pools joined");
+
+        for (int i = 20; i < 23; i++) B.insertAsLast(Elem(i)); // 源列表继续使用合并后的池
+        A.splice(A.first(), B);
+    } // B、C 先于 A 销毁
+    const int expect[] = { 20, 21, 22, 12, 0, 1, 2, 3, 4, 5, 6, 10, 11, 7 };
+    fail += check(equals(A, expect, 14), "contents after splicing");
+
+    NodePoolStats const& s = A.allocator().stats();
+    fail += check(s.inUse == 14 + 2, "pool statistics: 14 elements plus the two sentinels of A");
+    fail += check(A.remove(A.first()).value() == 20 && A.size() == 13, "remove a node taken over from another list");
+    return fail ? 1 : 0;
+}
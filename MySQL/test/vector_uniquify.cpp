@@ -0,0 +1,21 @@
+// Vector::uniquify 回归测试：元素类型非平凡（std::string）时，保留者不得被自移动清空
+#include "MyLibrary/Vector.h"
+#include <string>
+#include <cstdio>
+
+int main() {
+    const char* in[] = { "aaaa", "bbbb", "cccc", "cccc", "dddd", "dddd", "dddd", "eeee" };
+    const char* expect[] = { "aaaa", "bbbb", "cccc", "dddd", "eeee" };
+    Vector<std::string> V;
+    for (const char* s : in) V.insert(std::string(s));
+    int removed = V.uniquify();
+    int fail = 0;
+    if (removed != 3 || V.size() != 5) { printf("removed %d, size %d\n", removed, V.size()); fail++; }
+    for (int i = 0; i < V.size() && i < 5; i++)
+        if (V[i] != expect[i]) { printf("V[%d] = \"%s\", expected \"%s\"\n", i, V[i].c_str(), expect[i]); fail++; }
+
+    Vector<std::string> W; // 无重复
+    for (int i = 0; i < 4; i++) W.insert(std::string(1, char('a' + i)) + "xyz");
+    if (W.uniquify() != 0 || W[0] != "axyz" || W[3] != "dxyz") { printf("no-duplicate case corrupted\n"); fail++; }
+    return fail ? 1 : 0;
+}
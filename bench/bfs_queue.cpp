@@ -0,0 +1,83 @@
+// BFS 队列 基准测试
+// 在随机稀疏无向图（邻接表以 CSR 形式存放，平均度数约 8）上做广度优先搜索，比较两种辅助队列：
+//   Vector 队列 —— 原实现，出队即 remove(0)，每次搬迁其余全部元素
+//   Queue       —— 循环数组实现（Queen.h）
+// BFS 过程与 Graph::BFS 相同（发现即入队、出队时记录 dTime），两者的 dTime 校验和应一致。
+// Vector 队列出队为 O(n)，规模较大时极慢，默认只在不超过 10^5 个顶点时运行。
+// 用法：bfs_queue [最大顶点数] [Vector 队列的顶点数上限]
+// 编译：g++ -std=c++11 -O2 bench/bfs_queue.cpp -o bfs_queue
+#include "../MySQL/include/MyLibrary/Queen.h"
+#include "../MySQL/include/MyLibrary/Random.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+using namespace std;
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/* 原实现：以向量首元素为队首 */
+template <typename T>
+class VectorQueue {
+    Vector<T> data;
+public:
+    void enqueue(const T& e) { data.insert(e); }
+    T dequeue() { return data.remove(0); }
+    bool empty() const { return data.empty(); }
+};
+
+struct Csr { // 邻接表：顶点 v 的邻居为 adj[off[v] .. off[v + 1])
+    int n; Vector<int> off, adj;
+    Csr(int n, int degree, Xoshiro256& rng) : n(n), off(n + 1, n + 1, 0) {
+        int m = n * degree / 2;
+        Vector<int> a(m, m, 0), b(m, m, 0);
+        for (int i = 0; i < m; i++) { a[i] = rng.uniform(n); b[i] = rng.uniform(n); off[a[i] + 1]++; off[b[i] + 1]++; }
+        for (int v = 0; v < n; v++) off[v + 1] += off[v];
+        Vector<int> pos(off);
+        adj = Vector<int>(2 * m, 2 * m, 0);
+        for (int i = 0; i < m; i++) { adj[pos[a[i]]++] = b[i]; adj[pos[b[i]]++] = a[i]; }
+    }
+};
+
+template <typename Q>
+static long long bfs(Csr const& g, double& ms) { // 全图 BFS，返回 dTime 的加权校验和
+    Vector<int> dTime(g.n, g.n, 0); // 0 表示尚未发现
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int clock = 0;
+    for (int s = 0; s < g.n; s++) {
+        if (dTime[s]) continue;
+        Q q; dTime[s] = -1; q.enqueue(s);
+        while (!q.empty()) {
+            int v = q.dequeue(); dTime[v] = ++clock;
+            for (int k = g.off[v]; k < g.off[v + 1]; k++)
+                if (!dTime[g.adj[k]]) { dTime[g.adj[k]] = -1; q.enqueue(g.adj[k]); }
+        }
+    }
+    ms = elapsedMs(start);
+    long long sum = 0;
+    for (int v = 0; v < g.n; v++) sum += (long long) dTime[v] * (v % 1000 + 1);
+    return sum;
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int vectorLimit = (argc > 2) ? atoi(argv[2]) : 100000;
+    cout << "顶点数   Vector 队列 ms      Queue ms    校验和" << endl;
+    for (int n = 10000; n <= maxN; n *= 10) {
+        Xoshiro256 rng(n);
+        Csr g(n, 8, rng);
+        double msRing, msVector;
+        long long sumRing = bfs<Queue<int> >(g, msRing);
+        cout << left << setw(9) << n << right << fixed << setprecision(1);
+        if (n <= vectorLimit) {
+            long long sumVector = bfs<VectorQueue<int> >(g, msVector);
+            cout << setw(14) << msVector;
+            if (sumVector != sumRing) cout << " (校验和不符)";
+        } else cout << setw(16) << "跳过"; // 汉字占两列、三字节
+        cout << setw(14) << msRing << "    " << sumRing << endl;
+    }
+    return 0;
+}
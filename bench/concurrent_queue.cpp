@@ -0,0 +1,62 @@
+// 并发队列 吞吐量 基准测试
+// P 个生产者线程共写入 N 个整数，C 个消费者线程将其全部读出，报告每秒传递的元素数（百万），
+// 比较：互斥锁保护的 Queue、MpmcQueue（P = C = 1, 2, 4, 8, 16），以及 SpscQueue（仅 1:1）。
+// 生产者用阻塞式 push，消费者用阻塞式 pop；末行校验和为所有读出元素之和，应为 N(N - 1)/2。
+// 用法：concurrent_queue [元素数] [队列容量]
+// 编译：g++ -std=c++11 -O2 -pthread bench/concurrent_queue.cpp -o concurrent_queue
+#include "../MySQL/include/MyLibrary/ConcurrentQueue.h"
+#include "../MySQL/include/MyLibrary/Queen.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <mutex>
+#include <cstdlib>
+
+using namespace std;
+
+/* 对照：以互斥锁保护的有界 Queue，接口与 MpmcQueue 相同 */
+class LockedQueue {
+    mutex _m; Queue<long long> _q; size_t _cap;
+public:
+    explicit LockedQueue(size_t cap) : _cap(cap) {}
+    bool tryPush(long long e) { lock_guard<mutex> g(_m); if ((size_t) _q.size() >= _cap) return false; _q.enqueue(e); return true; }
+    bool tryPop(long long& e) { lock_guard<mutex> g(_m); if (_q.empty()) return false; e = _q.dequeue(); return true; }
+    void push(long long e) { for (int spins = 0; !tryPush(e); ) concurrentBackoff(spins); }
+    void pop(long long& e) { for (int spins = 0; !tryPop(e); ) concurrentBackoff(spins); }
+};
+
+template <typename Q>
+static double run(Q& q, int producers, int consumers, long long n, long long& checksum) { // 返回百万元素/秒
+    Vector<thread*> ts;
+    Vector<long long> sums(consumers, consumers, 0LL);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int p = 0; p < producers; p++) // 第 p 个生产者写入 p, p + P, p + 2P, ...
+        ts.insert(new thread([&q, p, producers, n] { for (long long i = p; i < n; i += producers) q.push(i); }));
+    for (int c = 0; c < consumers; c++) // 各消费者读出的个数预先均分
+        ts.insert(new thread([&q, &sums, c, consumers, n] {
+            long long e, s = 0;
+            for (long long k = n / consumers + (c < n % consumers); 0 < k; k--) { q.pop(e); s += e; }
+            sums[c] = s;
+        }));
+    for (int i = 0; i < ts.size(); i++) { ts[i]->join(); delete ts[i]; }
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (int c = 0; c < consumers; c++) checksum += sums[c];
+    return n / sec / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    long long n = (argc > 1) ? atoll(argv[1]) : 2000000;
+    size_t cap = (argc > 2) ? (size_t) atoll(argv[2]) : 1024;
+    cout << "元素数: " << n << "，队列容量: " << cap << "，硬件线程数: " << thread::hardware_concurrency() << endl;
+    cout << "P:C         mutex+Queue    MpmcQueue    SpscQueue   （百万元素/秒）" << endl;
+    long long checksum = 0; int runs = 0;
+    for (int t = 1; t <= 16; t *= 2) {
+        cout << right << setw(3) << t << ":" << left << setw(3) << t << right << fixed << setprecision(2);
+        { LockedQueue q(cap); cout << setw(16) << run(q, t, t, n, checksum); runs++; }
+        { MpmcQueue<long long> q(cap); cout << setw(13) << run(q, t, t, n, checksum); runs++; }
+        if (t == 1) { SpscQueue<long long> q(cap); cout << setw(13) << run(q, 1, 1, n, checksum); runs++; }
+        cout << endl;
+    }
+    cout << "校验和" << (checksum == runs * (n * (n - 1) / 2) ? "正确" : "错误") << endl;
+    return 0;
+}
@@ -0,0 +1,63 @@
+// 并发栈 吞吐量 基准测试
+// 模拟以栈为共享任务池的 DFS 式扩展：T 个线程各自反复随机地压入或弹出（各占一半），
+// 比较互斥锁保护的 Stack、ConcurrentStack，以及启用消去数组的 ConcurrentStack，线程数 1 ~ 32，
+// 报告每秒完成的操作数（百万）。末行校验：压入元素之和 = 弹出元素之和 + 栈中剩余元素之和。
+// 用法：concurrent_stack [总操作数] [消去数组宽度]
+// 编译：g++ -std=c++11 -O2 -pthread bench/concurrent_stack.cpp -o concurrent_stack
+#include "../MySQL/include/MyLibrary/ConcurrentStack.h"
+#include "../MySQL/include/MyLibrary/Stack.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <mutex>
+#include <cstdlib>
+
+using namespace std;
+
+/* 对照：以互斥锁保护的 Stack，接口与 ConcurrentStack 相同 */
+class LockedStack {
+    mutex _m; Stack<long long> _s;
+public:
+    void push(long long e) { lock_guard<mutex> g(_m); _s.push(e); }
+    bool pop(long long& e) { lock_guard<mutex> g(_m); if (_s.empty()) return false; e = _s.pop(); return true; }
+};
+
+template <typename S>
+static double run(S& s, int threads, long long ops, bool& balanced) { // 返回百万操作/秒
+    Vector<thread*> ts;
+    Vector<long long> pushed(threads, threads, 0LL), popped(threads, threads, 0LL);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++)
+        ts.insert(new thread([&s, &pushed, &popped, t, threads, ops] {
+            Xoshiro256 rng(t + 1);
+            long long in = 0, out = 0, e;
+            for (long long k = ops / threads; 0 < k; k--)
+                if (rng.uniform(2)) { s.push(k); in += k; }
+                else if (s.pop(e)) out += e;
+            pushed[t] = in; popped[t] = out;
+        }));
+    for (int i = 0; i < ts.size(); i++) { ts[i]->join(); delete ts[i]; }
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    long long in = 0, out = 0, e;
+    for (int t = 0; t < threads; t++) { in += pushed[t]; out += popped[t]; }
+    while (s.pop(e)) out += e; // 剩余元素
+    balanced = balanced && in == out;
+    return ops / sec / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    long long ops = (argc > 1) ? atoll(argv[1]) : 4000000;
+    int width = (argc > 2) ? atoi(argv[2]) : 16;
+    cout << "总操作数: " << ops << "，消去数组宽度: " << width << "，硬件线程数: " << thread::hardware_concurrency() << endl;
+    cout << "线程数  mutex+Stack  ConcurrentStack  +消去数组   （百万操作/秒）" << endl;
+    bool balanced = true;
+    for (int t = 1; t <= 32; t *= 2) {
+        cout << setw(6) << t << fixed << setprecision(2);
+        { LockedStack s; cout << setw(13) << run(s, t, ops, balanced); }
+        { ConcurrentStack<long long> s; cout << setw(17) << run(s, t, ops, balanced); }
+        { ConcurrentStack<long long> s(width); cout << setw(11) << run(s, t, ops, balanced); }
+        cout << endl;
+    }
+    cout << "校验" << (balanced ? "正确" : "错误") << endl;
+    return 0;
+}
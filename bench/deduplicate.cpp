@@ -0,0 +1,74 @@
+// 无序去重 基准测试
+// 记录按 (user, item) 判等，约半数重复：旧版 find + remove（O(n^2)，逐个删除并后移）与
+// 散列去重（O(n)，一趟压缩）的 Vector / List 对比。旧版仅在较小规模上运行。
+// 编译：g++ -std=c++11 -O2 bench/deduplicate.cpp -o deduplicate
+#include "../MySQL/include/MyLibrary/Vector.h"
+#include "../MySQL/include/MyLibrary/List.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std;
+
+struct Record {
+    int user, item;
+    float score;
+    bool operator==(Record const& r) const { return user == r.user && item == r.item; }
+};
+
+struct RecordHash {
+    size_t operator()(Record const& r) const { return (size_t) r.user * 1000003u ^ (size_t) r.item; }
+};
+
+/* 旧版无序去重：在前缀中查找雷同者，命中则删除当前元素（其后继整体前移） */
+template <typename T>
+int legacyDeduplicate(Vector<T>& V) {
+    int oldSize = V.size();
+    Rank i = 1;
+    while (i < V.size())
+        (V.find(V[i], 0, i) < 0) ? ++i : (V.remove(i), 0);
+    return oldSize - V.size();
+}
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+static void records(int n, Vector<Record>& V) {
+    srand(2025);
+    V.reserve(n);
+    for (int i = 0; i < n; i++) {
+        Record r = { rand() % (n / 4 + 1), rand() % 2, float(i) };
+        V.insert(r);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int big = (argc > 1) ? atoi(argv[1]) : 1000000;
+    cout << left << setw(12) << "n" << setw(22) << "实现" << right << setw(12) << "删除数" << setw(14) << "时间(ms)" << endl;
+    int sizes[] = { 20000, 50000, big };
+    for (int n : sizes) {
+        Vector<Record> src;
+        records(n, src);
+        if (n <= 50000) {
+            Vector<Record> V = src;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            int removed = legacyDeduplicate(V);
+            cout << left << setw(12) << n << setw(22) << "Vector find+remove" << right << setw(12) << removed
+                 << setw(14) << fixed << setprecision(2) << elapsedMs(start) << endl;
+        }
+        Vector<Record> V = src;
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        int removed = V.deduplicate(RecordHash(), std::equal_to<Record>());
+        cout << left << setw(12) << n << setw(22) << "Vector 散列" << right << setw(12) << removed
+             << setw(14) << fixed << setprecision(2) << elapsedMs(start) << endl;
+
+        List<Record> L;
+        for (int i = 0; i < n; i++) L.insertAsLast(src[i]);
+        start = chrono::steady_clock::now();
+        removed = L.deduplicate(RecordHash(), std::equal_to<Record>());
+        cout << left << setw(12) << n << setw(22) << "List 散列" << right << setw(12) << removed
+             << setw(14) << fixed << setprecision(2) << elapsedMs(start) << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+// 列表节点池 基准测试
+// 模拟长期存在的列表持续增删节点：先填入一批元素，再反复在随机位置附近删除旧节点、插入新节点，
+// 比较逐个 new/delete（HeapNodeAllocator）与节点池（NodePool，缺省）的耗时与分配次数，
+// 并输出节点池的占用统计。
+// 用法：list_pool [常驻节点数] [增删轮数]
+// 编译：g++ -std=c++11 -O2 -DMYLIBRARY_STATS bench/list_pool.cpp -o list_pool
+#include "../MySQL/include/MyLibrary/List.h"
+#include "../MySQL/include/MyLibrary/Random.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+using namespace std;
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <typename L>
+static double churn(L& list, int live, int rounds, long long& allocs) {
+    Xoshiro256 rng(2025);
+    OpStats before = OpStats::get();
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < live; i++) list.insertAsLast(i);
+    ListNode<int>* p = list.first();
+    for (int r = 0; r < rounds; r++) { // 游标随机前移若干步，删除其处节点并在附近插入新节点
+        for (int k = rng.uniform(8); 0 < k; k--) { p = p->succ; if (!list.valid(p)) p = list.first(); }
+        ListNode<int>* q = p->succ;
+        list.remove(p);
+        p = list.valid(q) ? q : list.first();
+        list.insertBefore(p, r);
+    }
+    double ms = elapsedMs(start);
+    allocs = (OpStats::get() - before).allocs;
+    return ms;
+}
+
+int main(int argc, char* argv[]) {
+    int live = (argc > 1) ? atoi(argv[1]) : 100000;
+    int rounds = (argc > 2) ? atoi(argv[2]) : 5000000;
+    cout << "常驻节点数: " << live << "，增删轮数: " << rounds << endl;
+
+    long long allocs;
+    {
+        List<int, HeapNodeAllocator<ListNode<int> > > L;
+        double ms = churn(L, live, rounds, allocs);
+        cout << left << setw(20) << "new/delete" << right << setw(10) << fixed << setprecision(1) << ms << " ms"
+             << setw(12) << allocs << " 次分配" << endl;
+    }
+    {
+        List<int> L;
+        double ms = churn(L, live, rounds, allocs);
+        cout << left << setw(20) << "NodePool" << right << setw(10) << ms << " ms" << setw(12) << allocs << " 次分配" << endl;
+        NodePoolStats const& s = L.allocator().stats();
+        cout << "节点池: " << s.chunks << " 块，容量 " << s.capacity << "，在用 " << s.inUse << "，峰值 " << s.peak
+             << "，占用率 " << setprecision(1) << 100 * s.occupancy() << "%，" << s.bytes / 1024 << " KB" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+// 向量持久化 基准测试
+// n 个边界框：saveTo 写出；旧方式逐条读出再逐个 insert 重建；MappedVector 映射打开、
+// 校验和核对、整体复制为 Vector，以及在映射数据上直接查找。
+// 编译：g++ -std=c++11 -O2 bench/mapped_vector.cpp -o mapped_vector
+// 运行：mapped_vector [n] [文件路径]
+#include "../MySQL/include/MyLibrary/MappedVector.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std;
+
+struct BoundingBox {
+    int id;
+    float x1, y1, x2, y2;
+    float confidence;
+    bool suppressed;
+    bool operator<(const BoundingBox& other) const { return confidence < other.confidence; }
+    bool operator==(const BoundingBox& other) const { return id == other.id; }
+};
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, double ms) {
+    cout << "  " << left << setw(30) << name << right << setw(12) << fixed << setprecision(2) << ms << " ms" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 5000000;
+    const char* path = (argc > 2) ? argv[2] : "mapped_vector.bin";
+    srand(2025);
+    Vector<BoundingBox> boxes;
+    boxes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        float x = float(rand() % 900), y = float(rand() % 900);
+        BoundingBox b = { i, x, y, x + 50, y + 50, 0.5f + (rand() % 50001) / 100000.0f, false };
+        boxes.insert(b);
+    }
+    boxes.sort();
+    cout << "边界框数: " << n << "，文件大小: " << (sizeof(VectorFileHeader) + sizeof(BoundingBox) * (size_t) n) / (1 << 20) << " MB" << endl;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    if (!boxes.saveTo(path)) { cout << "写出失败: " << path << endl; return 1; }
+    report("saveTo", elapsedMs(start));
+
+    start = chrono::steady_clock::now();
+    {
+        FILE* fp = fopen(path, "rb");
+        VectorFileHeader h;
+        if (!fp || fread(&h, sizeof(h), 1, fp) != 1) { cout << "读取失败" << endl; return 1; }
+        Vector<BoundingBox> V;
+        BoundingBox b;
+        while (fread(&b, sizeof(b), 1, fp) == 1) V.insert(b);
+        fclose(fp);
+    }
+    report("逐条读出并 insert 重建", elapsedMs(start));
+
+    start = chrono::steady_clock::now();
+    MappedVector<BoundingBox> M(path);
+    report("MappedVector 打开", elapsedMs(start));
+    if (!M.valid() || M.size() != n) { cout << "映射失败" << endl; return 1; }
+
+    start = chrono::steady_clock::now();
+    bool ok = M.verify();
+    report(ok ? "verify（校验和一致）" : "verify（校验和不符!）", elapsedMs(start));
+
+    start = chrono::steady_clock::now();
+    Vector<BoundingBox> copy(M.data(), M.size());
+    report("整体复制为 Vector", elapsedMs(start));
+
+    start = chrono::steady_clock::now();
+    int hits = 0;
+    for (int i = 0; i < 100000; i++) {
+        BoundingBox q = boxes[(int) ((long long) i * 7919 % n)];
+        hits += (M.search(q) >= 0);
+    }
+    report("映射数据上 search × 10^5", elapsedMs(start));
+    remove(path);
+    return hits == 100000 ? 0 : 1;
+}
@@ -0,0 +1,50 @@
+// 基本操作计数
+// 以 Counted<int> 为元素、开启 MYLIBRARY_STATS，逐次统计 Vector 各排序策略、查找与去重，
+// 以及 List 去重的比较 / 复制 / 移动 / 交换 / 分配次数。n = 100 时计时器读数为 0，计数仍可区分各算法。
+// 编译：g++ -std=c++11 -O2 bench/op_counts.cpp -o op_counts
+#define MYLIBRARY_STATS
+#include "../MySQL/include/MyLibrary/Vector.h"
+#include "../MySQL/include/MyLibrary/List.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+typedef Counted<int> Item;
+
+static void report(const char* name, OpStats const& s) {
+    cout << "  " << left << setw(20) << name << right << setw(12) << s.compares << setw(12) << s.copies
+         << setw(12) << s.moves << setw(10) << s.swaps << setw(8) << s.allocs << setw(12) << s.bytes << endl;
+}
+
+int main() {
+    const char* names[] = { "introsort", "bubble", "selection", "insertion", "merge", "heap", "quick" };
+    SortPolicy policies[] = { SORT_INTRO, SORT_BUBBLE, SORT_SELECTION, SORT_INSERTION, SORT_MERGE, SORT_HEAP, SORT_QUICK };
+    int sizes[] = { 100, 1000, 10000 };
+    for (int n : sizes) {
+        srand(n);
+        Vector<Item> src;
+        for (int i = 0; i < n; i++) src.insert(Item(rand() % (n / 2)));
+        cout << "n = " << n << endl;
+        cout << "  " << left << setw(20) << "操作" << right << setw(12) << "比较" << setw(12) << "复制"
+             << setw(12) << "移动" << setw(10) << "交换" << setw(8) << "分配" << setw(12) << "字节" << endl;
+
+        for (int k = 0; k < 7; k++) {
+            if (n > 1000 && (policies[k] == SORT_BUBBLE || policies[k] == SORT_SELECTION)) continue;
+            Vector<Item> V = src;
+            report(names[k], measure([&] { V.sort(policies[k]); }));
+        }
+
+        Vector<Item> sorted = src;
+        sorted.sort();
+        report("search × n", measure([&] { for (int i = 0; i < n; i++) sorted.search(src[i]); }));
+        report("find × n", measure([&] { for (int i = 0; i < n; i++) src.find(src[i]); }));
+
+        Vector<Item> V = src;
+        report("Vector 去重", measure([&] { V.deduplicate(); }));
+        List<Item> L;
+        for (int i = 0; i < n; i++) L.insertAsLast(src[i]);
+        report("List 去重", measure([&] { L.deduplicate(); }));
+    }
+    return 0;
+}
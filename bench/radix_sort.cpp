@@ -0,0 +1,82 @@
+// 基数排序 基准测试
+// 以 exp4 的边界框为负载，按 float 置信度降序排序：radixSort 与内省排序、归并排序（升序后反转）对比；
+// 另测 32 位整数关键码。
+// 编译：g++ -std=c++11 -O2 bench/radix_sort.cpp -o radix_sort
+#include "../MySQL/include/MyLibrary/Vector.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std;
+
+struct BoundingBox {
+    int id;
+    float x1, y1, x2, y2;
+    float confidence;
+    bool suppressed;
+    bool operator<(const BoundingBox& other) const { return confidence < other.confidence; }
+};
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+static void reverse(Vector<BoundingBox>& V) {
+    for (int i = 0, j = V.size() - 1; i < j; i++, j--) std::swap(V[i], V[j]);
+}
+
+static bool descending(Vector<BoundingBox> const& V) {
+    for (int i = 1; i < V.size(); i++)
+        if (V[i - 1].confidence < V[i].confidence) return false;
+    return true;
+}
+
+static void report(const char* name, double ms, double base, bool ok) {
+    cout << "  " << left << setw(28) << name << right << setw(10) << fixed << setprecision(1) << ms << " ms"
+         << "  x" << setprecision(2) << base / ms << (ok ? "" : "  [顺序错误!]") << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 2000000;
+    srand(2025);
+    Vector<BoundingBox> boxes;
+    boxes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        float x = float(rand() % 900), y = float(rand() % 900);
+        BoundingBox b = { i, x, y, x + 50 + rand() % 100, y + 50 + rand() % 100,
+                          0.5f + (rand() % 50001) / 100000.0f, false };
+        boxes.insert(b);
+    }
+    cout << "边界框数: " << n << "（按置信度降序）" << endl;
+
+    Vector<BoundingBox> V = boxes;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    V.sort(); reverse(V);
+    double base = elapsedMs(start);
+    report("sort (introsort) + 反转", base, base, descending(V));
+
+    V = boxes;
+    start = chrono::steady_clock::now();
+    V.mergeSort(0, V.size()); reverse(V);
+    report("mergeSort + 反转", elapsedMs(start), base, descending(V));
+
+    V = boxes;
+    start = chrono::steady_clock::now();
+    V.radixSort(0, V.size(), [](const BoundingBox& b) { return b.confidence; }, true);
+    report("radixSort (float, 降序)", elapsedMs(start), base, descending(V));
+
+    cout << "32 位整数: " << n << endl;
+    Vector<int> keys;
+    keys.reserve(n);
+    for (int i = 0; i < n; i++) keys.insert(rand() - RAND_MAX / 2);
+    Vector<int> K = keys;
+    start = chrono::steady_clock::now();
+    K.sort();
+    base = elapsedMs(start);
+    report("sort (introsort)", base, base, !K.disordered());
+    K = keys;
+    start = chrono::steady_clock::now();
+    K.radixSort(0, K.size(), [](int k) { return k; });
+    report("radixSort (int)", elapsedMs(start), base, !K.disordered());
+    return 0;
+}
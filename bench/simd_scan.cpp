@@ -0,0 +1,79 @@
+// 向量扫描 SIMD 基准测试
+// 对数百万元素的 int、float、double 列，分别以逐个处理、SSE2、AVX2 三档执行
+// find（查找不存在的值，扫描全列）、disordered、min、max、sum，比较耗时并校验三档结果一致。
+// 用法：simd_scan [规模] [重复次数]
+// 编译：g++ -std=c++11 -O2 bench/simd_scan.cpp -o simd_scan
+#include "../MySQL/include/MyLibrary/Vector.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+using namespace std;
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+#ifdef MYLIBRARY_SIMD_X86
+static const char* levelName[] = { "scalar", "SSE2", "AVX2" };
+
+template <typename T>
+static void benchColumn(const char* type, int n, int reps) {
+    Xoshiro256 rng(2025);
+    Vector<T> V;
+    V.reserve(n);
+    for (int i = 0; i < n; i++) V.insert(T(rng.uniform(1000000)));
+    cout << "\n" << type << " x " << n << endl;
+    cout << left << setw(8) << "" << right;
+    const char* ops[] = { "find", "disordered", "min", "max", "sum" };
+    for (const char* op : ops) cout << setw(12) << op;
+    cout << "  (ms)" << endl;
+
+    double first[5];
+    for (int level = SIMD_SCALAR; level <= (int) simdDetect(); level++) {
+        setSimdLevel((SimdLevel) level);
+        double result[5], ms[5];
+        chrono::steady_clock::time_point start;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) result[0] = V.find(T(-1)); // 不存在，扫描全列
+        ms[0] = elapsedMs(start) / reps;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) result[1] = V.disordered();
+        ms[1] = elapsedMs(start) / reps;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) result[2] = V.min();
+        ms[2] = elapsedMs(start) / reps;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) result[3] = V.max();
+        ms[3] = elapsedMs(start) / reps;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) result[4] = double(V.sum());
+        ms[4] = elapsedMs(start) / reps;
+
+        cout << left << setw(8) << levelName[level] << right << fixed << setprecision(3);
+        for (int k = 0; k < 5; k++) cout << setw(12) << ms[k];
+        if (level == SIMD_SCALAR) for (int k = 0; k < 5; k++) first[k] = result[k];
+        else for (int k = 0; k < 5; k++) // 浮点求和的次序不同，允许末位误差
+            if (k == 4 ? (abs(result[k] - first[k]) > 1e-9 * abs(first[k])) : (result[k] != first[k]))
+                cout << "  [" << ops[k] << " 结果不一致!]";
+        cout << endl;
+    }
+    setSimdLevel(simdDetect());
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 4000000;
+    int reps = (argc > 2) ? atoi(argv[2]) : 20;
+#ifdef MYLIBRARY_SIMD_X86
+    cout << "CPU 支持: " << levelName[simdDetect()] << endl;
+    benchColumn<int>("int", n, reps);
+    benchColumn<float>("float", n, reps);
+    benchColumn<double>("double", n, reps);
+#else
+    cout << "当前平台未启用 SIMD，仅有逐个处理的版本" << endl;
+    (void) n; (void) reps;
+#endif
+    return 0;
+}
@@ -0,0 +1,56 @@
+// 静态查找索引 基准测试
+// 有序 int 向量上随机查找：binSearch 与 SortedIndex（Eytzinger 布局）的单个查找、批量查找对比。
+// 规模从常驻 L1/L2 到远超末级缓存，各方法的结果逐一核对。
+// 编译：g++ -std=c++11 -O2 bench/sorted_index.cpp -o sorted_index
+#include "../MySQL/include/MyLibrary/SortedIndex.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std;
+
+static double elapsedNs(chrono::steady_clock::time_point start, int queries) {
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+static int nextRand() { seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17; return int(seed >> 33); }
+
+int main(int argc, char* argv[]) {
+    int queries = (argc > 1) ? atoi(argv[1]) : 2000000;
+    cout << left << setw(12) << "n" << setw(10) << "数据(KB)"
+         << right << setw(14) << "binSearch" << setw(14) << "search" << setw(14) << "lookup"
+         << setw(10) << "加速比" << "   (ns/次)" << endl;
+
+    int sizes[] = { 1 << 10, 1 << 14, 1 << 17, 1 << 20, 1 << 23, 1 << 25 };
+    for (int n : sizes) {
+        Vector<int> V;
+        V.reserve(n);
+        for (int i = 0; i < n; i++) V.insert(nextRand());
+        V.sort();
+        SortedIndex<int> index(V);
+        Vector<int> keys;
+        keys.reserve(queries);
+        for (int i = 0; i < queries; i++) keys.insert(nextRand());
+        Vector<Rank> a(queries, queries, 0), b(queries, queries, 0), c(queries, queries, 0);
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int i = 0; i < queries; i++) a[i] = binSearch(V.data(), keys[i], 0, n);
+        double tBin = elapsedNs(start, queries);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < queries; i++) b[i] = index.search(keys[i]);
+        double tOne = elapsedNs(start, queries);
+
+        start = chrono::steady_clock::now();
+        index.lookup(keys.data(), queries, c.data());
+        double tBatch = elapsedNs(start, queries);
+
+        bool ok = true;
+        for (int i = 0; i < queries; i++) ok = ok && a[i] == b[i] && a[i] == c[i];
+        cout << left << setw(12) << n << setw(10) << (long long) n * sizeof(int) / 1024
+             << right << fixed << setprecision(1) << setw(14) << tBin << setw(14) << tOne << setw(14) << tBatch
+             << setw(9) << setprecision(2) << tBin / tBatch << "x" << (ok ? "" : "  [结果不符!]") << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+// 展开链表 基准测试
+// 比较 List<int> 与 UnrolledList<int> 在同样规模下的：尾部追加建表、顺序遍历求和、无序查找（不命中）、
+// 以及反复在当前中点（按秩定位）处插入的耗时。
+// 用法：unrolled_list [元素数] [中点插入次数]
+// 编译：g++ -std=c++11 -O2 bench/unrolled_list.cpp -o unrolled_list
+#include "../MySQL/include/MyLibrary/List.h"
+#include "../MySQL/include/MyLibrary/UnrolledList.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+using namespace std;
+
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+struct Sum { long long s; void operator()(int& e) { s += e; } };
+
+static void report(char const* name, double build, double walk, double find, double mid, long long check) {
+    cout << left << setw(16) << name << right << fixed << setprecision(1)
+         << setw(10) << build << setw(10) << walk << setw(10) << find << setw(12) << mid
+         << "    (" << check << ")" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int inserts = (argc > 2) ? atoi(argv[2]) : 1000;
+    cout << "元素数: " << n << "，中点插入次数: " << inserts << "（单位 ms，括号内为校验和）" << endl;
+    cout << string(16, ' ') << "      建表      遍历      查找    中点插入" << endl;
+    chrono::steady_clock::time_point t;
+    {
+        List<int> L;
+        t = chrono::steady_clock::now();
+        for (int i = 0; i < n; i++) L.insertAsLast(i);
+        double build = elapsedMs(t);
+        Sum sum = { 0 };
+        t = chrono::steady_clock::now();
+        L.traverse(sum);
+        double walk = elapsedMs(t);
+        t = chrono::steady_clock::now();
+        bool found = L.find(-1) != NULL;
+        double find = elapsedMs(t);
+        t = chrono::steady_clock::now();
+        for (int k = 0; k < inserts; k++) { // 自首节点步进至中点
+            ListNode<int>* p = L.first();
+            for (int r = L.size() / 2; 0 < r; r--) p = p->succ;
+            L.insertBefore(p, k);
+        }
+        double mid = elapsedMs(t);
+        report("List", build, walk, find, mid, sum.s + found + L.size());
+    }
+    {
+        UnrolledList<int> L;
+        t = chrono::steady_clock::now();
+        for (int i = 0; i < n; i++) L.insertAsLast(i);
+        double build = elapsedMs(t);
+        Sum sum = { 0 };
+        t = chrono::steady_clock::now();
+        L.traverse(sum);
+        double walk = elapsedMs(t);
+        t = chrono::steady_clock::now();
+        bool found = L.valid(L.find(-1));
+        double find = elapsedMs(t);
+        t = chrono::steady_clock::now();
+        for (int k = 0; k < inserts; k++) L.insertBefore(L.locate(L.size() / 2), k); // 逐块跳至中点
+        double mid = elapsedMs(t);
+        report("UnrolledList", build, walk, find, mid, sum.s + found + L.size());
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+// 向量移动语义 / 原始空间 基准测试
+// 对比旧版 Vector（new T[] + 逐元素复制赋值）与当前 Vector（移动 + 就地构造 + realloc）
+// 在 exp4（边界框生成、复制、NMS 结果收集）与 exp3（邻接矩阵逐顶点扩张）两类负载下的
+// 构造 / 复制 / 移动次数与缓冲区分配次数。
+// 编译：g++ -std=c++11 -O2 bench/vector_move.cpp -o vector_move
+#define MYLIBRARY_STATS
+#include "../MySQL/include/MyLibrary/Vector.h"
+#include <iostream>
+#include <iomanip>
+#include <ctime>
+
+using namespace std;
+
+/* ---------- 计数元素：与 exp4 中 BoundingBox 布局相同 ---------- */
+struct Counter {
+    long long defaults, copies, moves; // 值构造、复制、移动次数
+    static Counter& get() { static Counter c = { 0, 0, 0 }; return c; }
+    static void reset() { get().defaults = get().copies = get().moves = 0; }
+};
+
+struct Box {
+    int id; float x1, y1, x2, y2, confidence; bool suppressed;
+    Box(int id = 0, float x1 = 0, float y1 = 0, float x2 = 0, float y2 = 0, float conf = 0)
+        : id(id), x1(x1), y1(y1), x2(x2), y2(y2), confidence(conf), suppressed(false) { Counter::get().defaults++; }
+    Box(Box const& b) { assign(b); Counter::get().copies++; }
+    Box(Box&& b) noexcept { assign(b); Counter::get().moves++; }
+    Box& operator=(Box const& b) { assign(b); Counter::get().copies++; return *this; }
+    Box& operator=(Box&& b) noexcept { assign(b); Counter::get().moves++; return *this; }
+    void assign(Box const& b) {
+        id = b.id; x1 = b.x1; y1 = b.y1; x2 = b.x2; y2 = b.y2;
+        confidence = b.confidence; suppressed = b.suppressed;
+    }
+};
+
+/* ---------- 旧版 Vector 的增长与复制策略（仅保留本测试所需接口） ---------- */
+static long long legacyAllocs = 0;
+
+template <typename T>
+class LegacyVector {
+    Rank _size; int _capacity; T* _elem;
+    void copyFrom(T const* A, Rank lo, Rank hi) {
+        _elem = new T[_capacity = 2 * (hi - lo)]; legacyAllocs++;
+        _size = 0;
+        while (lo < hi) _elem[_size++] = A[lo++];
+    }
+    void expand() {
+        if (_size < _capacity) return;
+        if (_capacity < DEFAULT_CAPACITY) _capacity = DEFAULT_CAPACITY;
+        T* oldElem = _elem;
+        _elem = new T[_capacity <<= 1]; legacyAllocs++;
+        for (int i = 0; i < _size; ++i) _elem[i] = oldElem[i];
+        delete[] oldElem;
+    }
+public:
+    LegacyVector(int c = DEFAULT_CAPACITY, int s = 0, T v = T())
+    { _elem = new T[_capacity = c]; legacyAllocs++; for (_size = 0; _size < s; _elem[_size++] = v); }
+    LegacyVector(LegacyVector<T> const& V) { copyFrom(V._elem, 0, V._size); }
+    ~LegacyVector() { delete[] _elem; }
+    LegacyVector<T>& operator=(LegacyVector<T> const& V) {
+        if (this == &V) return *this;
+        delete[] _elem; copyFrom(V._elem, 0, V._size);
+        return *this;
+    }
+    Rank size() const { return _size; }
+    T& operator[](Rank r) { return _elem[r]; }
+    Rank insert(T const& e) { expand(); _elem[_size] = e; return _size++; }
+};
+
+/* ---------- exp4 负载：生成 n 个框、复制一份、NMS 收集约一半结果 ---------- */
+template <typename V>
+int exp4Workload(int n) {
+    V boxes;
+    for (int i = 0; i < n; i++) {
+        float x = float(i % 900), y = float((i * 7) % 900);
+        boxes.insert(Box(i, x, y, x + 50, y + 50, 0.5f + (i % 51) / 100.0f));
+    }
+    V boxes_copy = boxes;
+    V result;
+    for (int i = 0; i < boxes_copy.size(); i += 2) result.insert(boxes_copy[i]);
+    return result.size();
+}
+
+/* 新接口下的写法：emplace_back 就地构造 */
+int exp4WorkloadEmplace(int n) {
+    Vector<Box> boxes;
+    for (int i = 0; i < n; i++) {
+        float x = float(i % 900), y = float((i * 7) % 900);
+        boxes.emplace_back(i, x, y, x + 50, y + 50, 0.5f + (i % 51) / 100.0f);
+    }
+    Vector<Box> boxes_copy = boxes;
+    Vector<Box> result;
+    for (int i = 0; i < boxes_copy.size(); i += 2) result.insert(boxes_copy[i]);
+    return result.size();
+}
+
+/* ---------- exp3 负载：GraphMatrix::insert 逐顶点扩张邻接矩阵 ---------- */
+template <typename Row, typename Matrix>
+int exp3Workload(int n) {
+    Matrix E;
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < k; j++) E[j].insert(NULL);
+        E.insert(Row(k + 1, k + 1, (int*) NULL));
+    }
+    return E.size();
+}
+
+static void report(const char* workload, const char* impl, long long allocs, double ms) {
+    Counter& c = Counter::get();
+    cout << left << setw(22) << workload << setw(16) << impl
+         << right << setw(12) << c.defaults << setw(12) << c.copies << setw(12) << c.moves
+         << setw(12) << allocs << setw(12) << fixed << setprecision(3) << ms << endl;
+}
+
+#define RUN(workload, impl, allocExpr, call) do { \
+        Counter::reset(); OpStats::reset(); legacyAllocs = 0; \
+        clock_t start = clock(); call; clock_t end = clock(); \
+        report(workload, impl, allocExpr, double(end - start) * 1000 / CLOCKS_PER_SEC); \
+    } while (0)
+
+int main() {
+    cout << left << setw(22) << "负载" << setw(16) << "实现"
+         << right << setw(12) << "值构造" << setw(12) << "复制" << setw(12) << "移动"
+         << setw(12) << "分配次数" << setw(12) << "时间(ms)" << endl;
+
+    int sizes[] = { 5000, 100000 };
+    for (int n : sizes) {
+        char name[64];
+        snprintf(name, sizeof(name), "exp4 boxes n=%d", n);
+        RUN(name, "legacy", legacyAllocs, exp4Workload<LegacyVector<Box> >(n));
+        RUN(name, "insert", OpStats::get().allocs, exp4Workload<Vector<Box> >(n));
+        RUN(name, "emplace_back", OpStats::get().allocs, exp4WorkloadEmplace(n));
+    }
+
+    int vertices[] = { 200, 1000 };
+    for (int n : vertices) {
+        char name[64];
+        snprintf(name, sizeof(name), "exp3 matrix V=%d", n);
+        RUN(name, "legacy", legacyAllocs,
+            (exp3Workload<LegacyVector<int*>, LegacyVector<LegacyVector<int*> > >(n)));
+        RUN(name, "current", OpStats::get().allocs,
+            (exp3Workload<Vector<int*>, Vector<Vector<int*> > >(n)));
+    }
+    return 0;
+}
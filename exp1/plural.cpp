@@ -2,6 +2,7 @@
 #include <cmath>
 #include <ctime>
 #include "../MySQL/include/MyLibrary/Vector.h"  // 使用您提供的Vector头文件
+#include "../MySQL/include/MyLibrary/VectorView.h"
 
 // 复数类定义
 class Complex {
@@ -95,9 +96,9 @@ TestVector<Complex> generateRandomComplexVector(int size) {
     return vec;
 }
 
-// 打印向量的函数 - 对于大向量只打印部分元素
-template <typename T>
-void printVector(const Vector<T>& vec, const std::string& name, int maxDisplay = 10) {
+// 打印向量（或向量视图）的函数 - 对于大向量只打印部分元素
+template <typename V>
+void printVector(const V& vec, const std::string& name, int maxDisplay = 10) {
     std::cout << name << " (大小: " << vec.size() << "): ";
     if (vec.size() <= maxDisplay) {
         for (Rank i = 0; i < vec.size(); ++i) {
@@ -150,19 +151,22 @@ void testSortingEfficiency(TestVector<T>& vec, const std::string& state) {
     testSpecificSort(vec, "归并排序", &TestVector<T>::testMergeSort);
 }
 
-// 区间查找函数：查找模在[m1, m2)之间的所有元素
-Vector<Complex> rangeSearchByMagnitude(const Vector<Complex>& sortedVec, double m1, double m2) {
-    Vector<Complex> result;
-    
-    // 遍历有序向量，找到所有满足条件的元素
-    for (Rank i = 0; i < sortedVec.size(); ++i) {
-        double mag = sortedVec[i].magnitude();
-        if (mag >= m1 && mag < m2) {
-            result.insert(sortedVec[i]);
-        }
+// 有序向量中首个模不小于m的元素的秩（二分查找）
+Rank lowerBoundByMagnitude(const Vector<Complex>& sortedVec, double m) {
+    Rank lo = 0, hi = sortedVec.size();
+    while (lo < hi) {
+        Rank mi = (lo + hi) >> 1;
+        (sortedVec[mi].magnitude() < m) ? lo = mi + 1 : hi = mi;
     }
-    
-    return result;
+    return lo;
+}
+
+// 区间查找函数：查找模在[m1, m2)之间的所有元素
+// 向量按模有序，这些元素必然连续，二分定出两端后返回视图，不复制元素
+VectorView<const Complex> rangeSearchByMagnitude(const Vector<Complex>& sortedVec, double m1, double m2) {
+    Rank lo = lowerBoundByMagnitude(sortedVec, m1);
+    Rank hi = lowerBoundByMagnitude(sortedVec, m2);
+    return VectorView<const Complex>(sortedVec, lo, (lo < hi) ? hi : lo);
 }
 
 #include <windows.h>
@@ -263,7 +267,7 @@ int main() {
     
     // 查找模在[50, 150)之间的元素
     double m1 = 50.0, m2 = 150.0;
-    Vector<Complex> rangeResult = rangeSearchByMagnitude(sortedVec, m1, m2);
+    VectorView<const Complex> rangeResult = rangeSearchByMagnitude(sortedVec, m1, m2);
     
     std::cout << "模在 [" << m1 << ", " << m2 << ") 之间的元素:" << std::endl;
     if (rangeResult.size() > 0) {
@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include "../MySQL\Vector.h"
+#include "../MySQL\include\MyLibrary\SoAVector.h"
 
 using namespace std;
 
@@ -110,6 +111,49 @@ Vector<BoundingBox> basicNMS(Vector<BoundingBox>& boxes, float iou_threshold = 0
     return result;
 }
 
+// 按列存放的边界框：坐标、置信度与ID各占一列
+enum { BOX_X1, BOX_Y1, BOX_X2, BOX_Y2, BOX_CONF, BOX_ID };
+typedef SoAVector<float, float, float, float, float, int> BoxColumns;
+
+BoxColumns toColumns(const Vector<BoundingBox>& boxes) {
+    BoxColumns columns(boxes.size());
+    for (int i = 0; i < boxes.size(); i++) {
+        const BoundingBox& b = boxes[i];
+        columns.insert(b.x1, b.y1, b.x2, b.y2, b.confidence, b.id);
+    }
+    return columns;
+}
+
+// 按列存放的NMS：按置信度降序重排各列后，内层循环只依次读取四个坐标数组，
+// 且不含分支（以 inter > 阈值 * union 代替除法），便于编译器向量化；返回保留框的ID
+Vector<int> columnNMS(BoxColumns& boxes, float iou_threshold = 0.5) {
+    boxes.sortBy<BOX_CONF>(true);
+    int n = boxes.size();
+    const float* x1 = boxes.column<BOX_X1>();
+    const float* y1 = boxes.column<BOX_Y1>();
+    const float* x2 = boxes.column<BOX_X2>();
+    const float* y2 = boxes.column<BOX_Y2>();
+    Vector<float> area(n, n, 0.0f);
+    for (int i = 0; i < n; i++) area[i] = (x2[i] - x1[i]) * (y2[i] - y1[i]);
+    Vector<char> suppressed(n, n, '\0');
+    
+    Vector<int> kept;
+    for (int i = 0; i < n; i++) {
+        if (suppressed[i]) continue;
+        kept.insert(boxes.get<BOX_ID>(i));
+        float bx1 = x1[i], by1 = y1[i], bx2 = x2[i], by2 = y2[i], barea = area[i];
+        char* s = suppressed.data();
+        const float* a = area.data();
+        for (int j = i + 1; j < n; j++) {
+            float w = max(0.0f, min(bx2, x2[j]) - max(bx1, x1[j]));
+            float h = max(0.0f, min(by2, y2[j]) - max(by1, y1[j]));
+            float inter = w * h;
+            s[j] |= inter > iou_threshold * (barea + a[j] - inter);
+        }
+    }
+    return kept;
+}
+
 // 降序排序函数
 void sortDescending(Vector<BoundingBox>& boxes, int left, int right) {
     // 使用选择排序实现降序
@@ -129,21 +173,17 @@ void sortDescending(Vector<BoundingBox>& boxes, int left, int right) {
 // 随机分布生成边界框
 Vector<BoundingBox> generateRandomBoxes(int n, int image_width = 1000, int image_height = 1000) {
     Vector<BoundingBox> boxes;
-    static bool seeded = false;
-    if (!seeded) {
-        srand(time(nullptr));
-        seeded = true;
-    }
+    Xoshiro256& rng = threadRng(); // 由 main 统一播种，同一种子生成同一组数据
     
     for (int i = 0; i < n; i++) {
         // 随机生成位置和大小
-        float width = 50 + rand() % 100;  // 宽度50-150
-        float height = 50 + rand() % 100; // 高度50-150
-        float x = rand() % (image_width - (int)width);
-        float y = rand() % (image_height - (int)height);
+        float width = 50 + rng.uniform(100);  // 宽度50-150
+        float height = 50 + rng.uniform(100); // 高度50-150
+        float x = rng.uniform(image_width - (int)width);
+        float y = rng.uniform(image_height - (int)height);
         
         // 随机生成置信度（0.5-1.0）
-        float confidence = 0.5 + (rand() % 51) / 100.0;
+        float confidence = 0.5 + rng.uniform(51) / 100.0;
         
         boxes.insert(BoundingBox(i, x, y, x + width, y + height, confidence));
     }
@@ -154,17 +194,13 @@ Vector<BoundingBox> generateRandomBoxes(int n, int image_width = 1000, int image
 // 聚集分布生成边界框
 Vector<BoundingBox> generateClusteredBoxes(int n, int clusters = 10, int image_width = 1000, int image_height = 1000) {
     Vector<BoundingBox> boxes;
-    static bool seeded = false;
-    if (!seeded) {
-        srand(time(nullptr));
-        seeded = true;
-    }
+    Xoshiro256& rng = threadRng();
     
     // 生成聚类中心
     float center_x[100], center_y[100];
     for (int c = 0; c < clusters; c++) {
-        center_x[c] = rand() % image_width;
-        center_y[c] = rand() % image_height;
+        center_x[c] = rng.uniform(image_width);
+        center_y[c] = rng.uniform(image_height);
     }
     
     // 在每个聚类中心周围生成边界框
@@ -177,10 +213,10 @@ Vector<BoundingBox> generateClusteredBoxes(int n, int clusters = 10, int image_w
         
         for (int i = 0; i < boxes_to_generate; i++) {
             // 在聚类中心附近生成
-            float offset_x = (rand() % 200) - 100;  // ±100像素偏移
-            float offset_y = (rand() % 200) - 100;
-            float width = 40 + rand() % 60;         // 宽度40-100
-            float height = 40 + rand() % 60;        // 高度40-100
+            float offset_x = rng.uniform(200) - 100;  // ±100像素偏移
+            float offset_y = rng.uniform(200) - 100;
+            float width = 40 + rng.uniform(60);       // 宽度40-100
+            float height = 40 + rng.uniform(60);      // 高度40-100
             
             float x = max(0.0f, min((float)image_width - width, center_x[c] + offset_x));
             float y = max(0.0f, min((float)image_height - height, center_y[c] + offset_y));
@@ -231,6 +267,31 @@ void testNMSPerformance(Vector<BoundingBox>& boxes, const string& sort_name,
     cout << sort_name << " + NMS 总时间: " << elapsed << " 秒, 保留框数: " << result.size() << endl;
 }
 
+// 测试 Top-K + NMS 性能：只选出置信度最高的 k 个候选框并排序，O(n + klogk)，再对其做 NMS
+void testTopKNMSPerformance(Vector<BoundingBox>& boxes, int k) {
+    clock_t start = clock();
+    Vector<BoundingBox> candidates = boxes.topK(k, CompareDesc());
+    
+    // 执行NMS
+    Vector<BoundingBox> result = basicNMS(candidates);
+    
+    clock_t end = clock();
+    double elapsed = double(end - start) / CLOCKS_PER_SEC;
+    
+    cout << "Top-" << k << " 选取 + NMS 总时间: " << elapsed << " 秒, 保留框数: " << result.size() << endl;
+}
+
+// 测试按列存放的NMS性能（含转换为列与按置信度重排）
+void testColumnNMSPerformance(const Vector<BoundingBox>& boxes) {
+    clock_t start = clock();
+    BoxColumns columns = toColumns(boxes);
+    Vector<int> kept = columnNMS(columns);
+    clock_t end = clock();
+    double elapsed = double(end - start) / CLOCKS_PER_SEC;
+    
+    cout << "按列存放 + NMS 总时间: " << elapsed << " 秒, 保留框数: " << kept.size() << endl;
+}
+
 // 包装函数
 void bubbleSortWrapper(Vector<BoundingBox>& boxes, int lo, int hi) {
     // 由于Vector的排序是升序，而我们需要降序，所以需要特殊处理
@@ -273,17 +334,24 @@ void quickSortWrapper(Vector<BoundingBox>& boxes, int lo, int hi) {
     }
 }
 
+void radixSortWrapper(Vector<BoundingBox>& boxes, int lo, int hi) {
+    // 以置信度为关键码，直接得到降序
+    boxes.radixSort(lo, hi, [](const BoundingBox& b) { return b.confidence; }, true);
+}
+
 #include <windows.h>
-int main() {
+int main(int argc, char* argv[]) {
     SetConsoleOutputCP(65001);  // 设置控制台为 UTF-8 编码
     SetConsoleCP(65001);
-    srand(time(0));  // 设置随机种子
-
-    srand(time(nullptr));
+    // 设置随机种子：可由命令行指定，以便复现某次测试的数据
+    unsigned long long seed = (argc > 1) ? strtoull(argv[1], NULL, 10) : (unsigned long long) time(nullptr);
+    seedRandom(seed);
+    cout << "随机种子: " << seed << endl;
     
     cout << "NMS算法性能测试:" << endl ;
     // 测试不同数据规模
     int test_sizes[] = {100, 500, 1000, 5000};
+    const int TOP_K = 100; // Top-K 方案保留的候选框数
     
     for (int size : test_sizes) {
         cout << "\n测试数据规模: " << size << endl;
@@ -297,12 +365,16 @@ int main() {
         testSortPerformance(random_boxes, "选择排序", selectionSortWrapper);
         testSortPerformance(random_boxes, "归并排序", mergeSortWrapper);
         testSortPerformance(random_boxes, "快速排序", quickSortWrapper);
+        testSortPerformance(random_boxes, "基数排序", radixSortWrapper);
         
         cout << "\nNMS算法性能:" << endl;
         testNMSPerformance(random_boxes, "起泡排序", bubbleSortWrapper);
         testNMSPerformance(random_boxes, "选择排序", selectionSortWrapper);
         testNMSPerformance(random_boxes, "归并排序", mergeSortWrapper);
         testNMSPerformance(random_boxes, "快速排序", quickSortWrapper);
+        testNMSPerformance(random_boxes, "基数排序", radixSortWrapper);
+        testTopKNMSPerformance(random_boxes, TOP_K);
+        testColumnNMSPerformance(random_boxes);
         
         // 测试聚集分布
         cout << "\n聚集分布" << endl;
@@ -313,12 +385,16 @@ int main() {
         testSortPerformance(clustered_boxes, "选择排序", selectionSortWrapper);
         testSortPerformance(clustered_boxes, "归并排序", mergeSortWrapper);
         testSortPerformance(clustered_boxes, "快速排序", quickSortWrapper);
+        testSortPerformance(clustered_boxes, "基数排序", radixSortWrapper);
         
         cout << "\nNMS算法性能:" << endl;
         testNMSPerformance(clustered_boxes, "起泡排序", bubbleSortWrapper);
         testNMSPerformance(clustered_boxes, "选择排序", selectionSortWrapper);
         testNMSPerformance(clustered_boxes, "归并排序", mergeSortWrapper);
         testNMSPerformance(clustered_boxes, "快速排序", quickSortWrapper);
+        testNMSPerformance(clustered_boxes, "基数排序", radixSortWrapper);
+        testTopKNMSPerformance(clustered_boxes, TOP_K);
+        testColumnNMSPerformance(clustered_boxes);
     }
     return 0;
 }
\ No newline at end of file